@@ -0,0 +1,157 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include "../include/adaptive_exec/ExecutionEngine.hpp"
+#include "../include/adaptive_exec/AlmgrenChrissSolver.hpp"
+#include "../include/adaptive_exec/ExecutionScheduler.hpp"
+#include <queue>
+#include <random>
+
+using namespace AdaptiveExec;
+
+// Replanning parent orders: legacy ExecutionEngine::getExecutionSchedule (allocates, exp per
+// period) vs Almgren-Chriss schedules from cached fractions and from the closed form.
+// Releasing child slices of 100k live parents: ExecutionScheduler (timer wheel) vs a
+// binary-heap timer queue doing the same lazy slice sizing.
+
+namespace {
+
+    volatile Scalar g_sink = 0.0;
+
+    template <typename Fn>
+    double bestSeconds(int repeats, Fn&& fn) {
+        double best = 1e300;
+        for (int r = 0; r < repeats; ++r) {
+            auto t0 = std::chrono::steady_clock::now();
+            fn();
+            auto t1 = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+        }
+        return best;
+    }
+
+}
+
+int main() {
+    const int n_parents = 10000;
+    AlmgrenChrissSolver cached;
+    AlmgrenChrissSolver uncached(std::vector<int>{});
+
+    std::cout << "==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Parent-Order Replanning (" << n_parents << " parents)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+    std::cout << std::setw(10) << "Horizon" << std::setw(14) << "Legacy ns"
+              << std::setw(16) << "AC cached ns" << std::setw(18) << "AC closed ns" << std::endl;
+
+    for (int horizon : {10, 78, 390}) {
+        std::vector<Scalar> buffer(static_cast<size_t>(n_parents) * horizon);
+
+        double t_legacy = bestSeconds(5, [&]() {
+            Scalar acc = 0.0;
+            for (int p = 0; p < n_parents; ++p) {
+                Vector s = ExecutionEngine::getExecutionSchedule(static_cast<MarketRegime>(p % 3), 1000.0 + p, horizon);
+                acc += s(0);
+            }
+            g_sink = acc;
+        });
+
+        auto replan = [&](const AlmgrenChrissSolver& solver) {
+            Scalar acc = 0.0;
+            for (int p = 0; p < n_parents; ++p) {
+                Scalar* out = buffer.data() + static_cast<size_t>(p) * horizon;
+                solver.schedule(static_cast<MarketRegime>(p % 3), 1000.0 + p, horizon, out);
+                acc += out[0];
+            }
+            g_sink = acc;
+        };
+        double t_cached = bestSeconds(5, [&]() { replan(cached); });
+        double t_closed = bestSeconds(5, [&]() { replan(uncached); });
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(10) << horizon
+                  << std::setw(14) << t_legacy / n_parents * 1e9
+                  << std::setw(16) << t_cached / n_parents * 1e9
+                  << std::setw(18) << t_closed / n_parents * 1e9 << std::endl;
+    }
+
+    // --- Child-slice release ---
+    const size_t n_live = 100000;
+    std::mt19937_64 gen(3);
+    std::uniform_int_distribution<int> periods_dist(10, 390);
+    std::uniform_int_distribution<uint64_t> interval_dist(100, 60000);
+    std::uniform_int_distribution<uint64_t> start_dist(0, 60000);
+
+    struct Spec { Scalar qty; int periods; uint64_t interval; uint64_t start; };
+    std::vector<Spec> specs(n_live);
+    size_t total_slices = 0;
+    for (Spec& spec : specs) {
+        spec = Spec{1000.0, periods_dist(gen), interval_dist(gen), start_dist(gen)};
+        total_slices += spec.periods;
+    }
+
+    std::cout << "\n==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Child-Order Release (" << n_live << " live parents, "
+              << total_slices << " slices)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+
+    std::vector<ChildOrder> out;
+    out.reserve(1 << 16);
+    size_t released = 0;
+    double t_submit = 0.0;
+    double t_wheel = bestSeconds(3, [&]() {
+        ExecutionScheduler scheduler(0);
+        auto s0 = std::chrono::steady_clock::now();
+        for (const Spec& spec : specs) scheduler.submit(spec.qty, spec.periods, spec.interval, spec.start);
+        t_submit = std::chrono::duration<double>(std::chrono::steady_clock::now() - s0).count();
+
+        released = 0;
+        for (uint64_t t = 1000; scheduler.liveOrders() > 0; t += 1000) {
+            if (t % 1800000 == 0) scheduler.setRegime(static_cast<MarketRegime>((t / 1800000) % 3));
+            out.clear();
+            released += scheduler.advance(t, out);
+        }
+    });
+
+    // Heap baseline: (expiry, parent) min-heap, same sizing
+    struct Live { Scalar remaining; int periods_left; uint64_t interval; };
+    using Entry = std::pair<uint64_t, uint32_t>;
+    size_t heap_released = 0;
+    double t_heap = bestSeconds(3, [&]() {
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+        std::vector<Live> live(n_live);
+        for (uint32_t p = 0; p < n_live; ++p) {
+            live[p] = Live{specs[p].qty, specs[p].periods, specs[p].interval};
+            heap.push(Entry(std::max<uint64_t>(specs[p].start, 1), p));
+        }
+        MarketRegime regime = MarketRegime::Normal;
+        heap_released = 0;
+        for (uint64_t t = 1000; !heap.empty(); t += 1000) {
+            if (t % 1800000 == 0) regime = static_cast<MarketRegime>((t / 1800000) % 3);
+            out.clear();
+            while (!heap.empty() && heap.top().first <= t) {
+                Entry e = heap.top();
+                heap.pop();
+                Live& order = live[e.second];
+                Scalar qty = order.periods_left == 1 ? order.remaining
+                                                     : order.remaining * cached.firstFraction(regime, order.periods_left);
+                order.remaining -= qty;
+                --order.periods_left;
+                out.push_back(ChildOrder{e.second, e.first, qty, order.periods_left, regime});
+                ++heap_released;
+                if (order.periods_left > 0) heap.push(Entry(e.first + order.interval, e.second));
+            }
+        }
+    });
+
+    std::cout << std::fixed << std::setprecision(1)
+              << " Submit (timer wheel):           " << t_submit / n_live * 1e9 << " ns/parent" << std::endl
+              << " Release, timer wheel:           " << t_wheel / released * 1e9 << " ns/slice  ("
+              << released << " slices, " << std::setprecision(3) << t_wheel << " s)" << std::endl
+              << std::setprecision(1)
+              << " Release, binary heap:           " << t_heap / heap_released * 1e9 << " ns/slice  ("
+              << heap_released << " slices, " << std::setprecision(3) << t_heap << " s)" << std::endl;
+
+    return 0;
+}
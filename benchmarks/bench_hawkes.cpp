@@ -0,0 +1,145 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include "../include/adaptive_exec/HawkesCalibration.hpp"
+#include "../include/adaptive_exec/MultivariateHawkesModel.hpp"
+#include "../include/adaptive_exec/HawkesSimulator.hpp"
+
+using namespace AdaptiveExec;
+
+// Full-day calibration: likelihood + gradient pass and multi-start MLE on N trade timestamps.
+// Multivariate feed: per-event update and intensity-vector query cost vs dimension.
+// Monte Carlo: circuit-breaker trigger distribution over many simulated sessions.
+
+namespace {
+
+    volatile double g_sink = 0.0;
+
+    template <typename Fn>
+    double bestSeconds(int repeats, Fn&& fn) {
+        double best = 1e300;
+        for (int r = 0; r < repeats; ++r) {
+            auto t0 = std::chrono::steady_clock::now();
+            fn();
+            auto t1 = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+        }
+        return best;
+    }
+
+}
+
+int main() {
+    std::cout << "==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Hawkes MLE Calibration (mu=20, alpha=60, beta=100)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+    std::cout << std::setw(12) << "Events" << std::setw(16) << "LL+grad ms"
+              << std::setw(12) << "Fit ms" << std::setw(10) << "Iters"
+              << std::setw(10) << "mu" << std::setw(10) << "alpha" << std::setw(10) << "beta" << std::endl;
+
+    // One 6.5h session in seconds; the rate scales the event count
+    const double T = 23400.0;
+    for (double scale : {0.1, 1.0, 2.5}) {
+        std::vector<double> times;
+        HawkesSimulator(20.0 * scale, 60.0 * scale, 100.0 * scale).simulate(T, 5, times);
+
+        double grad[3];
+        double t_ll = bestSeconds(5, [&]() {
+            g_sink = HawkesCalibrator::logLikelihood(times, T, 20.0, 60.0, 100.0, grad);
+        });
+
+        HawkesFitResult fit{};
+        double t_fit = bestSeconds(1, [&]() { fit = HawkesCalibrator::fit(times, T); });
+
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(12) << times.size()
+                  << std::setw(16) << t_ll * 1e3
+                  << std::setw(12) << t_fit * 1e3
+                  << std::setw(10) << fit.iterations
+                  << std::setw(10) << fit.mu / scale
+                  << std::setw(10) << fit.alpha / scale
+                  << std::setw(10) << fit.beta / scale << std::endl;
+    }
+
+    std::cout << "\n==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Multivariate Hawkes Feed (1M events)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+    std::cout << std::setw(8) << "D" << std::setw(16) << "addEvent ns" << std::setw(16) << "query ns" << std::endl;
+
+    std::mt19937 gen(9);
+    for (int D : {2, 8, 32, 128}) {
+        const size_t n_events = 1000000;
+        std::exponential_distribution<> gap(1000.0);
+        std::uniform_int_distribution<> pick(0, D - 1);
+        std::vector<double> times(n_events);
+        std::vector<int> dims(n_events);
+        double t = 0.0;
+        for (size_t k = 0; k < n_events; ++k) {
+            t += gap(gen);
+            times[k] = t;
+            dims[k] = pick(gen);
+        }
+
+        Vector mu = Vector::Constant(D, 1.0);
+        Matrix alpha = Matrix::Constant(D, D, 0.5 / D);
+        Vector beta = Vector::LinSpaced(D, 5.0, 10.0);
+        MultivariateHawkesModel model(mu, alpha, beta);
+
+        double t_add = bestSeconds(3, [&]() {
+            model.reset();
+            model.addEvents(times.data(), dims.data(), n_events);
+            g_sink = model.getIntensity(t, 0);
+        });
+
+        Vector lam(D);
+        const size_t n_queries = 100000;
+        double t_query = bestSeconds(3, [&]() {
+            double acc = 0.0;
+            for (size_t q = 0; q < n_queries; ++q) {
+                model.getIntensity(t + 1e-6 * static_cast<double>(q), lam);
+                acc += lam(0);
+            }
+            g_sink = acc;
+        });
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(8) << D
+                  << std::setw(16) << t_add / n_events * 1e9
+                  << std::setw(16) << t_query / n_queries * 1e9 << std::endl;
+    }
+
+    std::cout << "\n==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Session Monte Carlo (mu=2, alpha=0.8, beta=1, T=100, limit=5)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+    std::cout << std::setw(10) << "Sessions" << std::setw(12) << "Total ms" << std::setw(14) << "ns/event"
+              << std::setw(12) << "P(trip)" << std::setw(12) << "p50 trig" << std::setw(12) << "p99 trig" << std::endl;
+
+    HawkesSimulator simulator(2.0, 0.8, 1.0);
+    for (size_t n_sessions : {1000, 10000, 100000}) {
+        std::vector<HawkesSessionStats> stats;
+        double t_mc = bestSeconds(3, [&]() { stats = simulator.simulateSessions(n_sessions, 100.0, 5.0, 42); });
+
+        size_t events = 0, tripped = 0;
+        std::vector<size_t> triggers(n_sessions);
+        for (size_t s = 0; s < n_sessions; ++s) {
+            events += stats[s].n_events;
+            tripped += stats[s].n_triggers > 0;
+            triggers[s] = stats[s].n_triggers;
+        }
+        std::sort(triggers.begin(), triggers.end());
+
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(10) << n_sessions
+                  << std::setw(12) << t_mc * 1e3
+                  << std::setw(14) << t_mc / static_cast<double>(events) * 1e9
+                  << std::setw(12) << static_cast<double>(tripped) / n_sessions
+                  << std::setw(12) << triggers[n_sessions / 2]
+                  << std::setw(12) << triggers[n_sessions * 99 / 100] << std::endl;
+    }
+
+    return 0;
+}
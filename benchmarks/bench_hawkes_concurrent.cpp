@@ -0,0 +1,110 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include "../include/adaptive_exec/HawkesModel.hpp"
+#include "../include/adaptive_exec/ConcurrentHawkesModel.hpp"
+
+using namespace AdaptiveExec;
+
+// One feed thread adding events as fast as it can while N strategy threads query the
+// decayed intensity: seqlock-published ConcurrentHawkesModel vs a mutex-guarded HawkesModel.
+
+namespace {
+
+    volatile double g_sink = 0.0;
+
+    // Mutex baseline with the same interface
+    class LockedHawkesModel {
+    public:
+        LockedHawkesModel(double mu, double alpha, double beta) : model_(mu, alpha, beta) {}
+
+        double addEvent(double timestamp) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return model_.addEvent(timestamp);
+        }
+
+        double getIntensity(double timestamp) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return model_.getIntensity(timestamp);
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        HawkesModel model_;
+    };
+
+    struct Throughput {
+        double writer_ns;  // Per addEvent
+        double reader_ns;  // Per query, averaged over readers
+    };
+
+    template <typename Model>
+    Throughput contend(Model& model, int n_readers, double seconds) {
+        std::atomic<bool> start(false), done(false);
+        std::atomic<long> queries(0);
+        std::vector<std::thread> readers;
+        for (int r = 0; r < n_readers; ++r) {
+            readers.emplace_back([&]() {
+                while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+                long local = 0;
+                double acc = 0.0;
+                while (!done.load(std::memory_order_relaxed)) {
+                    acc += model.getIntensity(1e9);
+                    ++local;
+                }
+                g_sink = acc;
+                queries += local;
+            });
+        }
+
+        start.store(true, std::memory_order_release);
+        auto t0 = std::chrono::steady_clock::now();
+        long events = 0;
+        double t = 0.0;
+        while (true) {
+            for (int k = 0; k < 1024; ++k) {
+                t += 1e-3;
+                model.addEvent(t);
+            }
+            events += 1024;
+            if (std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() > seconds) break;
+        }
+        done = true;
+        for (auto& th : readers) th.join();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+        Throughput out;
+        out.writer_ns = elapsed / events * 1e9;
+        out.reader_ns = n_readers > 0 ? elapsed * n_readers / static_cast<double>(queries.load()) * 1e9 : 0.0;
+        return out;
+    }
+
+}
+
+int main() {
+    std::cout << "==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Shared Hawkes Intensity (1 writer, N readers)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+    std::cout << " Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::setw(10) << "Readers"
+              << std::setw(16) << "Seqlock wr ns" << std::setw(16) << "Seqlock rd ns"
+              << std::setw(16) << "Mutex wr ns" << std::setw(16) << "Mutex rd ns" << std::endl;
+
+    for (int n_readers : {0, 1, 2, 4, 8}) {
+        ConcurrentHawkesModel seqlock(2.0, 0.8, 1.0);
+        LockedHawkesModel locked(2.0, 0.8, 1.0);
+        Throughput s = contend(seqlock, n_readers, 0.3);
+        Throughput m = contend(locked, n_readers, 0.3);
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(10) << n_readers
+                  << std::setw(16) << s.writer_ns << std::setw(16) << s.reader_ns
+                  << std::setw(16) << m.writer_ns << std::setw(16) << m.reader_ns << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <string>
+#include <unistd.h>
+#include "../include/adaptive_exec/utils/KillSwitch.hpp"
+
+using namespace AdaptiveExec;
+
+// Process-wide kill switch:
+//  - order-path cost of isTripped() (local and shared-memory mirrored),
+//  - trip-to-observe latency: one thread trips, N order threads spinning on isTripped()
+//    timestamp the moment they see it.
+
+namespace {
+
+    volatile long g_sink = 0;
+
+    template <typename Fn>
+    double bestSeconds(int repeats, Fn&& fn) {
+        double best = 1e300;
+        for (int r = 0; r < repeats; ++r) {
+            auto t0 = std::chrono::steady_clock::now();
+            fn();
+            auto t1 = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+        }
+        return best;
+    }
+
+    double percentile(std::vector<double> v, double p) {
+        if (v.empty()) return 0.0;
+        size_t k = static_cast<size_t>(p * (v.size() - 1));
+        std::nth_element(v.begin(), v.begin() + k, v.end());
+        return v[k];
+    }
+
+    int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Trip-to-observe latencies (ns) over all rounds and observers
+    std::vector<double> tripLatency(KillSwitch& halt, int n_observers, int rounds, bool spin) {
+        std::atomic<int> round(0), ready(0), observed(0);
+        std::atomic<bool> stop(false);
+        std::vector<std::vector<double>> samples(n_observers);
+        std::vector<std::thread> observers;
+
+        for (int o = 0; o < n_observers; ++o) {
+            observers.emplace_back([&, o]() {
+                for (int r = 1; r <= rounds; ++r) {
+                    while (round.load(std::memory_order_acquire) < r) {
+                        if (stop.load(std::memory_order_relaxed)) return;
+                        std::this_thread::yield();
+                    }
+                    ready.fetch_add(1);
+                    while (!halt.isTripped()) {
+                        if (!spin) std::this_thread::yield();
+                    }
+                    samples[o].push_back(static_cast<double>(nowNs() - halt.tripTimeNs()));
+                    observed.fetch_add(1);
+                }
+            });
+        }
+
+        for (int r = 1; r <= rounds; ++r) {
+            halt.reset();
+            ready = 0;
+            observed = 0;
+            round.store(r, std::memory_order_release);
+            while (ready.load() < n_observers) std::this_thread::yield();
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            halt.trip(TripReason::Manual);
+            while (observed.load() < n_observers) std::this_thread::yield();
+        }
+        stop = true;
+        for (auto& t : observers) t.join();
+        halt.reset();
+
+        std::vector<double> all;
+        for (auto& s : samples) all.insert(all.end(), s.begin(), s.end());
+        return all;
+    }
+
+}
+
+int main() {
+    const std::string segment = "/adaptive_exec_bench_" + std::to_string(getpid());
+    KillSwitch local;
+    KillSwitch shared;
+    bool have_shared = shared.attachShared(segment);
+
+    std::cout << "==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Kill Switch (order-path check, trip latency)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+
+    const long reps = 100000000;
+    double t_local = bestSeconds(5, [&]() {
+        long acc = 0;
+        for (long r = 0; r < reps; ++r) acc += local.isTripped();
+        g_sink = acc;
+    });
+    std::cout << std::fixed << std::setprecision(2)
+              << " isTripped(), local:            " << t_local / reps * 1e9 << " ns" << std::endl;
+    if (have_shared) {
+        double t_shared = bestSeconds(5, [&]() {
+            long acc = 0;
+            for (long r = 0; r < reps; ++r) acc += shared.isTripped();
+            g_sink = acc;
+        });
+        std::cout << " isTripped(), shared memory:    " << t_shared / reps * 1e9 << " ns" << std::endl;
+    }
+
+    // Busy-spinning observers only make sense with a core each
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << " Hardware threads: " << cores << std::endl;
+    std::cout << std::setw(10) << "Observers" << std::setw(10) << "Mode" << std::setw(12) << "Segment"
+              << std::setw(14) << "p50 ns" << std::setw(14) << "p99 ns" << std::setw(14) << "max ns" << std::endl;
+
+    for (int n_observers : {1, 2, 4}) {
+        bool spin = static_cast<unsigned>(n_observers) < cores;
+        for (int s = 0; s < (have_shared ? 2 : 1); ++s) {
+            KillSwitch& halt = s == 0 ? local : shared;
+            std::vector<double> lat = tripLatency(halt, n_observers, 500, spin);
+            std::cout << std::setw(10) << n_observers
+                      << std::setw(10) << (spin ? "spin" : "yield")
+                      << std::setw(12) << (s == 0 ? "local" : "shm")
+                      << std::setw(14) << std::setprecision(0) << percentile(lat, 0.50)
+                      << std::setw(14) << percentile(lat, 0.99)
+                      << std::setw(14) << *std::max_element(lat.begin(), lat.end())
+                      << std::setprecision(2) << std::endl;
+        }
+    }
+
+    if (have_shared) {
+        shared.detachShared();
+        KillSwitch::unlinkShared(segment);
+    }
+    return 0;
+}
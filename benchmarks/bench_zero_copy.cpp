@@ -0,0 +1,127 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "../include/adaptive_exec/VolatilityEstimators.hpp"
+#include "../include/adaptive_exec/RiskManager.hpp"
+#include "../include/adaptive_exec/HARModel.hpp"
+
+using namespace AdaptiveExec;
+
+// Heap allocations per call: owning-container API vs pointer/Eigen::Ref views.
+
+namespace {
+    std::atomic<size_t> g_allocations{0};
+    volatile Scalar g_sink = 0.0;
+}
+
+// Count every heap allocation. Eigen allocates through malloc directly, so on glibc
+// malloc itself is interposed; elsewhere only operator new is counted.
+#if defined(__GLIBC__)
+extern "C" void* __libc_malloc(std::size_t size);
+
+extern "C" void* malloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+#else
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#endif
+
+namespace {
+
+    struct Measurement {
+        double allocs_per_call;
+        double ns_per_call;
+    };
+
+    template <typename Fn>
+    Measurement measure(int calls, Fn&& fn) {
+        fn(0); // Warm-up (first-touch of per-thread scratch buffers)
+        size_t before = g_allocations.load();
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < calls; ++i) fn(i);
+        auto t1 = std::chrono::steady_clock::now();
+        size_t after = g_allocations.load();
+        return {static_cast<double>(after - before) / calls,
+                std::chrono::duration<double, std::nano>(t1 - t0).count() / calls};
+    }
+
+    void report(const char* name, const Measurement& copy, const Measurement& view) {
+        std::cout << std::left << std::setw(26) << name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(10) << copy.allocs_per_call
+                  << std::setw(10) << view.allocs_per_call
+                  << std::setprecision(0) << std::setw(14) << copy.ns_per_call
+                  << std::setw(12) << view.ns_per_call << std::endl;
+    }
+
+}
+
+int main() {
+    std::mt19937 gen(42);
+    std::normal_distribution<> noise(0.0, 0.001);
+    std::lognormal_distribution<> rv_dist(std::log(50.0), 0.5);
+
+    // Ring buffer of intraday returns: estimators run on a sliding 4,680-tick window
+    const size_t ring = 1 << 16, window = 4680;
+    std::vector<Scalar> ticks(ring);
+    for (auto& r : ticks) r = noise(gen);
+
+    const int n_days = 2520;
+    Vector tsrv(n_days), rj(n_days);
+    for (int i = 0; i < n_days; ++i) { tsrv[i] = rv_dist(gen); rj[i] = 0.1 * rv_dist(gen); }
+    HARModel har;
+    har.fit(tsrv.head(200), rj.head(200));
+
+    std::cout << "==========================================================" << std::endl;
+    std::cout << " BENCHMARK: Zero-Copy Views (heap allocations per call)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+    std::cout << std::left << std::setw(26) << "Entry point" << std::right << std::setw(10) << "copy"
+              << std::setw(10) << "view" << std::setw(14) << "copy ns" << std::setw(12) << "view ns" << std::endl;
+
+    const int calls = 2000;
+    auto offset = [&](int i) { return static_cast<size_t>(i * 17) % (ring - window); };
+
+    report("VolatilityEstimators",
+        measure(calls, [&](int i) {
+            std::vector<Scalar> slice(ticks.begin() + offset(i), ticks.begin() + offset(i) + window);
+            g_sink = VolatilityEstimators::computeTSRV(slice) + VolatilityEstimators::computeMedRV(slice);
+        }),
+        measure(calls, [&](int i) {
+            const Scalar* slice = ticks.data() + offset(i);
+            g_sink = VolatilityEstimators::computeTSRV(slice, window) + VolatilityEstimators::computeMedRV(slice, window);
+        }));
+
+    report("RiskManager::computeCVaR",
+        measure(calls, [&](int i) {
+            std::vector<Scalar> slice(ticks.begin() + offset(i), ticks.begin() + offset(i) + window);
+            g_sink = RiskManager::computeCVaR(slice);
+        }),
+        measure(calls, [&](int i) {
+            g_sink = RiskManager::computeCVaR(ticks.data() + offset(i), window);
+        }));
+
+    // The pre-view main.cpp loop copied tsrv.head(i+1) into a fresh Vector every day
+    report("HARModel::predict",
+        measure(n_days - 100, [&](int i) {
+            Vector hist_rv = tsrv.head(100 + i);
+            Vector hist_rj = rj.head(100 + i);
+            g_sink = har.predict(hist_rv, hist_rj);
+        }),
+        measure(n_days - 100, [&](int i) {
+            g_sink = har.predict(tsrv.head(100 + i), rj.head(100 + i));
+        }));
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Types.hpp"
+#include <array>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    // Per-regime market and preference inputs (all per period of the schedule)
+    struct AlmgrenChrissParams {
+        Scalar sigma;          // Price volatility per sqrt(period)
+        Scalar eta;            // Temporary impact: price concession per (shares / period)
+        Scalar gamma;          // Permanent impact: price move per share traded
+        Scalar risk_aversion;  // lambda in E[cost] + lambda * Var[cost]
+    };
+
+    // Expected implementation shortfall and its variance for a schedule
+    struct ScheduleCost {
+        Scalar expected;
+        Scalar variance;
+    };
+
+    /**
+     * @class AlmgrenChrissSolver
+     * @brief Closed-form Almgren-Chriss optimal execution schedules per market regime.
+     *
+     * Minimizes E[cost] + lambda Var[cost] for liquidating X shares over N periods with
+     * linear temporary (eta) and permanent (gamma) impact. The optimal holdings are
+     *   x_j = X sinh(kappa (N - j)) / sinh(kappa N),   cosh(kappa) = 1 + lambda sigma^2 / (2 eta~)
+     * with eta~ = eta - gamma / 2, so the trade in period j (1-based) is proportional to
+     *   r^{j-1} + r^{2N-j},   r = e^{-kappa}
+     * which is evaluated with one running product in each direction (no sinh / exp per
+     * period, no overflow for large kappa N). Higher volatility or risk aversion gives a
+     * larger kappa and a more front-loaded schedule; kappa -> 0 is TWAP.
+     *
+     * The schedule only depends on (regime, N), so normalized trade fractions for common
+     * horizons are precomputed; a replan is then one scaled copy into the caller's buffer.
+     * Uncached horizons fall back to the closed form (O(N), no allocation).
+     *
+     * Const methods are safe to call concurrently; setParameters() and precompute() are not.
+     */
+    class AlmgrenChrissSolver {
+    public:
+        // Horizons above this are never cached
+        static constexpr int kMaxCachedHorizon = 1024;
+
+        /**
+         * @brief Construct with default regime parameters (impact rising with volatility).
+         *
+         * @param cached_horizons Horizons to precompute for every regime
+         */
+        explicit AlmgrenChrissSolver(const std::vector<int>& cached_horizons = {5, 10, 20, 30, 60, 78, 390});
+
+        // Replace one regime's inputs and rebuild its cached schedules
+        void setParameters(MarketRegime regime, const AlmgrenChrissParams& params);
+
+        const AlmgrenChrissParams& getParameters(MarketRegime regime) const;
+
+        // Add horizons to the cache for every regime
+        void precompute(const std::vector<int>& horizons);
+
+        // Decay rate kappa per period of the optimal trajectory (0 = TWAP)
+        Scalar kappa(MarketRegime regime) const;
+
+        /**
+         * @brief Optimal trade sizes for each period.
+         *
+         * @param regime Market regime (selects sigma / impact / risk aversion)
+         * @param order_size Shares to execute (sign preserved)
+         * @param horizon Number of periods N
+         * @param out Caller buffer of at least N entries; sums to order_size
+         * @return false if horizon < 1
+         */
+        bool schedule(MarketRegime regime, Scalar order_size, int horizon, Scalar* out) const;
+
+        /**
+         * @brief Fraction of the remaining quantity to trade now with `horizon` periods left.
+         *
+         * The optimal trajectory is time-consistent: re-solving after each slice reproduces
+         * the rest of the original schedule. An executing order therefore only needs this
+         * first fraction per period, in O(1):
+         * (1 + r^{2N-1}) (1 - r) / (1 - r^{2N}), which is 1/N for kappa = 0.
+         * Tabulated for horizons up to kMaxCachedHorizon.
+         */
+        Scalar firstFraction(MarketRegime regime, int horizon) const;
+
+        // Same as schedule() into a Vector (resized to horizon)
+        Vector schedule(MarketRegime regime, Scalar order_size, int horizon) const;
+
+        // Optimal holdings after each period (N + 1 entries, from order_size down to 0)
+        bool holdings(MarketRegime regime, Scalar order_size, int horizon, Scalar* out) const;
+
+        /**
+         * @brief Almgren-Chriss cost moments of any schedule under a regime's parameters.
+         *
+         * E = gamma X^2 / 2 + eta~ sum n_j^2,  Var = sigma^2 sum_{j=1}^{N-1} x_j^2
+         */
+        ScheduleCost evaluate(MarketRegime regime, const Scalar* trades, int horizon) const;
+
+    private:
+        static int index(MarketRegime regime) { return static_cast<int>(regime); }
+
+        static Scalar firstFractionClosedForm(Scalar kappa, int horizon);
+
+        // Closed-form normalized fractions (sum to 1)
+        void fractions(int regime, int horizon, Scalar* out) const;
+
+        void rebuildCache(int regime);
+
+        std::array<AlmgrenChrissParams, 3> params_;
+        std::array<Scalar, 3> kappa_;
+        std::array<Scalar, 3> r_;                    // e^{-kappa} per regime
+
+        std::vector<int> cached_horizons_;
+        std::array<std::vector<Scalar>, 3> cache_;   // Concatenated fractions per regime
+        std::array<std::vector<int>, 3> offset_;     // Start in cache_ by horizon (-1 = not cached)
+        std::array<std::vector<Scalar>, 3> first_;   // firstFraction by horizon
+    };
+
+}
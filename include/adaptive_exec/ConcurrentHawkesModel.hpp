@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class ConcurrentHawkesModel
+     * @brief HawkesModel shared between one feed thread and any number of reader threads.
+     *
+     * The writer (market-data thread) adds events; strategy threads query the decayed
+     * intensity at any time. The recursion state (last_event_time, last_intensity) is
+     * published through a seqlock:
+     *
+     *  - addEvent(): sequence -> odd, store the state, sequence -> even (release).
+     *    Never blocks and never waits for readers.
+     *  - snapshot(): read the sequence, the state, and the sequence again; retry if a
+     *    write was in progress or happened in between. No stores, so readers do not
+     *    bounce the cache line between each other.
+     *
+     * Fields are relaxed atomics so a torn read is a retry rather than a data race. The
+     * published line is cache-line aligned and holds nothing else.
+     *
+     * addEvent() and reset() must only be called from a single writer thread.
+     */
+    class ConcurrentHawkesModel {
+    public:
+        // Consistent copy of the published recursion state
+        struct State {
+            double last_event_time;
+            double last_intensity;  // Intensity just after the last event
+            uint64_t n_events;      // Events since construction / reset
+        };
+
+        /**
+         * @brief Construct a new concurrent Hawkes model
+         *
+         * @param baseline (mu) Background intensity rate (events per time unit)
+         * @param alpha Excitation magnitude (jump in intensity per event)
+         * @param beta Decay rate (speed at which excitement fades)
+         */
+        ConcurrentHawkesModel(double baseline, double alpha, double beta)
+            : mu_(baseline), alpha_(alpha), beta_(beta) {
+            publish(0.0, baseline, 0);
+        }
+
+        ConcurrentHawkesModel(const ConcurrentHawkesModel&) = delete;
+        ConcurrentHawkesModel& operator=(const ConcurrentHawkesModel&) = delete;
+
+        /**
+         * @brief Add an event and publish the new state (writer thread only).
+         *
+         * @param timestamp Time of the new event (must be >= last event time)
+         * @return double The intensity immediately after the event (same as HawkesModel::addEvent)
+         */
+        double addEvent(double timestamp) {
+            // The writer owns the state: plain relaxed loads of its own stores
+            double last_time = shared_.last_event_time.load(std::memory_order_relaxed);
+            double last_intensity = shared_.last_intensity.load(std::memory_order_relaxed);
+            uint64_t n = shared_.n_events.load(std::memory_order_relaxed);
+
+            double dt = timestamp - last_time;
+            if (dt < 0) dt = 0; // Protection against out-of-order
+
+            double intensity_after = mu_ + (last_intensity - mu_) * std::exp(-beta_ * dt) + alpha_;
+            publish(timestamp, intensity_after, n + 1);
+            return intensity_after;
+        }
+
+        // Reset to the baseline (writer thread only)
+        void reset() { publish(0.0, mu_, 0); }
+
+        // Consistent (last_event_time, last_intensity, n_events); lock-free, any thread
+        State snapshot() const {
+            State s;
+            for (unsigned spins = 1;; ++spins) {
+                uint64_t seq0 = shared_.seq.load(std::memory_order_acquire);
+                if (seq0 & 1) {
+                    // Writer mid-update: a few ns unless it was preempted, then stop burning its core
+                    if (spins % 64 == 0) std::this_thread::yield();
+                    continue;
+                }
+                s.last_event_time = shared_.last_event_time.load(std::memory_order_relaxed);
+                s.last_intensity = shared_.last_intensity.load(std::memory_order_relaxed);
+                s.n_events = shared_.n_events.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (shared_.seq.load(std::memory_order_relaxed) == seq0) return s;
+            }
+        }
+
+        /**
+         * @brief Intensity at a query time from a consistent snapshot; lock-free, any thread.
+         *
+         * @param timestamp Query time (earlier than the last event returns the post-event intensity)
+         */
+        double getIntensity(double timestamp) const {
+            State s = snapshot();
+            double dt = timestamp - s.last_event_time;
+            if (dt < 0) return s.last_intensity;
+            return mu_ + (s.last_intensity - mu_) * std::exp(-beta_ * dt);
+        }
+
+        bool isCritical(double timestamp, double threshold) const {
+            return getIntensity(timestamp) > threshold;
+        }
+
+        double getBaseline() const { return mu_; }
+        double getAlpha() const { return alpha_; }
+        double getBeta() const { return beta_; }
+
+    private:
+        void publish(double timestamp, double intensity, uint64_t n) {
+            uint64_t seq = shared_.seq.load(std::memory_order_relaxed);
+            shared_.seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            shared_.last_event_time.store(timestamp, std::memory_order_relaxed);
+            shared_.last_intensity.store(intensity, std::memory_order_relaxed);
+            shared_.n_events.store(n, std::memory_order_relaxed);
+            shared_.seq.store(seq + 2, std::memory_order_release);
+        }
+
+        struct alignas(64) Shared {
+            std::atomic<uint64_t> seq{0};
+            std::atomic<double> last_event_time{0.0};
+            std::atomic<double> last_intensity{0.0};
+            std::atomic<uint64_t> n_events{0};
+        };
+
+        const double mu_;
+        const double alpha_;
+        const double beta_;
+
+        Shared shared_;
+    };
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Types.hpp"
+#include "VolatilityEstimators.hpp"
+#include "utils/ThreadPool.hpp"
+#include <vector>
+
+namespace AdaptiveExec {
+
+    // Structure-of-arrays view over the intraday returns of many symbols.
+    // Symbol s occupies returns[offsets[s], offsets[s+1]); offsets has n_symbols + 1 entries.
+    struct ReturnPanel {
+        const Scalar* returns;
+        const size_t* offsets;
+        size_t n_symbols;
+    };
+
+    // Columnar output table, one row per symbol
+    struct VolatilityTable {
+        std::vector<Scalar> rv;
+        std::vector<Scalar> bv;
+        std::vector<Scalar> medrv;
+        std::vector<Scalar> tsrv;
+        std::vector<Scalar> rj;
+
+        void resize(size_t n_symbols);
+        size_t size() const { return rv.size(); }
+    };
+
+    class CrossSectionalVolatility {
+    public:
+        // Compute RV/BV/MedRV/TSRV/RJ for every symbol of the panel with the fused
+        // single-pass kernel. Symbols are spread across the pool with work-stealing,
+        // so a few very long series do not leave the other cores idle.
+        // The table is resized to panel.n_symbols (no reallocation when reused).
+        static void compute(const ReturnPanel& panel, VolatilityTable& table,
+                            int K = 5, Scalar annualization_factor = 1.0,
+                            ThreadPool& pool = ThreadPool::global());
+    };
+
+}
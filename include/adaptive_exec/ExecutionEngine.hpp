@@ -14,8 +14,16 @@ namespace AdaptiveExec {
         // Returns vector of trade sizes for each period in horizon
         static Vector getExecutionSchedule(MarketRegime state, Scalar order_size, int time_horizon = 10);
 
-        // HFT Safety: Check if trading should halt due to Hawkes intensity
-        static bool checkCircuitBreaker(double current_intensity, double limit);
+        // Almgren-Chriss optimal schedule with the default regime parameters, written into
+        // out[0 .. time_horizon); cached for common horizons (see AlmgrenChrissSolver)
+        static bool getOptimalSchedule(MarketRegime state, Scalar order_size, int time_horizon, Scalar* out);
+
+        // HFT Safety: Check if trading should halt due to Hawkes intensity.
+        // With trip_kill_switch, a breach also trips KillSwitch::global() (halts every order path)
+        static bool checkCircuitBreaker(double current_intensity, double limit, bool trip_kill_switch = false);
+
+        // True while the process-wide kill switch is tripped
+        static bool isHalted();
     };
 
 }
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Types.hpp"
+#include "AlmgrenChrissSolver.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    // One child slice released by ExecutionScheduler
+    struct ChildOrder {
+        uint64_t parent_id;
+        uint64_t release_tick;
+        Scalar quantity;
+        int periods_left;        // Periods remaining after this slice (0 = parent complete)
+        MarketRegime regime;     // Regime the slice was sized under
+    };
+
+    /**
+     * @class ExecutionScheduler
+     * @brief Holds live parent orders and releases their child slices on schedule.
+     *
+     * Each parent has one pending timer for its next slice. Timers live in a hierarchical
+     * timer wheel of 4 levels x 256 slots over integer ticks (any unit, e.g. ms): level l
+     * holds timers due within 256^(l+1) ticks, and a level's slot is cascaded one level
+     * down when the tick reaches its block. Insert and cancel are O(1) (intrusive doubly
+     * linked slots); each timer is touched at most once per level. Empty stretches of
+     * time are skipped to the next block boundary of the lowest non-empty level.
+     *
+     * Slices are sized lazily at release: with n periods left, a slice is remaining x
+     * AlmgrenChrissSolver::firstFraction(regime, n). The Almgren-Chriss trajectory is
+     * time-consistent, so with an unchanged regime this reproduces the full schedule.
+     * After setRegime() every live parent re-slices its remaining quantity from its next
+     * release onwards. The regime change itself is O(1), no matter how many parents are live.
+     *
+     * While KillSwitch::global() is tripped nothing is released: each due slice is held for
+     * one interval (remaining quantity and periods left unchanged) and re-checked then, so
+     * the schedule resumes, re-sliced, once the switch is reset.
+     */
+    class ExecutionScheduler {
+    public:
+        /**
+         * @brief Construct a new scheduler.
+         *
+         * @param start_tick Current time
+         * @param regime Initial market regime
+         * @param solver Regime parameters used to size slices
+         */
+        explicit ExecutionScheduler(uint64_t start_tick = 0, MarketRegime regime = MarketRegime::Normal,
+                                    const AlmgrenChrissSolver& solver = AlmgrenChrissSolver());
+
+        /**
+         * @brief Add a parent order.
+         *
+         * @param quantity Shares to execute (sign preserved)
+         * @param periods Number of slices
+         * @param interval_ticks Ticks between slices (at least 1)
+         * @param first_release Tick of the first slice (past ticks release on the next advance())
+         * @return uint64_t Parent id (0 if periods < 1)
+         */
+        uint64_t submit(Scalar quantity, int periods, uint64_t interval_ticks, uint64_t first_release);
+
+        // Remove a live parent; false if unknown or already complete
+        bool cancel(uint64_t parent_id);
+
+        // Switch regime; remaining quantities are re-sliced at their next release
+        void setRegime(MarketRegime regime) { regime_ = regime; }
+
+        MarketRegime getRegime() const { return regime_; }
+
+        /**
+         * @brief Move time forward and release every slice due up to and including to_tick
+         * (none while the global kill switch is tripped).
+         *
+         * @param to_tick New current time
+         * @param out Released slices are appended in release-tick order
+         * @return size_t Number of slices released
+         */
+        size_t advance(uint64_t to_tick, std::vector<ChildOrder>& out);
+
+        // Unexecuted quantity of a live parent (0.0 if unknown)
+        Scalar remaining(uint64_t parent_id) const;
+
+        size_t liveOrders() const { return live_; }
+        uint64_t now() const { return now_; }
+
+    private:
+        static constexpr int kLevels = 4;
+        static constexpr int kSlotBits = 8;
+        static constexpr int kSlots = 1 << kSlotBits;
+        static constexpr uint64_t kSlotMask = kSlots - 1;
+        static constexpr int32_t kNone = -1;
+
+        // Parent order doubling as its own timer node
+        struct Parent {
+            uint64_t expiry;
+            int32_t prev;
+            int32_t next;
+            int32_t slot;          // Wheel slot (level * kSlots + index), kNone if free
+            uint32_t generation;   // Bumped on free so stale ids are rejected
+            Scalar remaining;
+            int periods_left;
+            uint64_t interval;
+        };
+
+        static uint64_t makeId(uint32_t index, uint32_t generation) {
+            return (static_cast<uint64_t>(generation) << 32) | (static_cast<uint64_t>(index) + 1);
+        }
+
+        // Index of a live parent, or kNone
+        int32_t find(uint64_t parent_id) const;
+
+        void insert(int32_t p);
+        void unlink(int32_t p);
+        void cascade(int level);
+        void fire(uint64_t tick, std::vector<ChildOrder>& out);
+        void release(int32_t p);
+
+        AlmgrenChrissSolver solver_;
+        MarketRegime regime_;
+        uint64_t now_;
+
+        std::vector<Parent> parents_;
+        std::vector<int32_t> free_;
+        size_t live_;
+
+        std::array<int32_t, kLevels * kSlots> heads_;
+        std::array<size_t, kLevels> level_count_;
+    };
+
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "Types.hpp"
+#include "HMMRegimeDetector.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class FixedHMMRegimeDetector
+     * @brief Compile-time specialised Gaussian HMM for a fixed number of states and features.
+     *
+     * Same model as HMMRegimeDetector, but built on fixed-size Eigen types so that the
+     * emission and Viterbi loops are fully unrolled and never touch the heap:
+     *  - log transition and start probabilities are precomputed once,
+     *  - each covariance is stored as its inverse Cholesky factor L^-1, so the
+     *    Mahalanobis term is ||L^-1 (x - mu)||^2 with a log-determinant of 2 * sum log L_ii.
+     *
+     * Intended for production models with 2-4 states and 2-3 features.
+     *
+     * @tparam N Number of hidden states (<= 255, back-pointers are stored as uint8)
+     * @tparam D Number of features
+     */
+    template <int N, int D>
+    class FixedHMMRegimeDetector {
+        static_assert(N >= 1 && N <= 255, "FixedHMMRegimeDetector supports 1..255 states");
+        static_assert(D >= 1, "FixedHMMRegimeDetector needs at least one feature");
+
+    public:
+        using StateVector = Eigen::Matrix<Scalar, N, 1>;
+        using StateMatrix = Eigen::Matrix<Scalar, N, N>;
+        using FeatureVector = Eigen::Matrix<Scalar, D, 1>;
+        using FeatureMatrix = Eigen::Matrix<Scalar, D, D>;
+
+        FixedHMMRegimeDetector() {
+            log_start_.setZero();
+            log_trans_.setZero();
+            for (int i = 0; i < N; ++i) {
+                means_[i].setZero();
+                inv_chol_[i].setIdentity();
+                log_norm_[i] = 0.0;
+            }
+        }
+
+        /**
+         * @brief Set the model parameters (same layout as HMMRegimeDetector::setParameters).
+         *
+         * @return false if the dimensions do not match <N, D> or a covariance is not
+         *         positive definite (the previous parameters are then left unchanged)
+         */
+        bool setParameters(const Vector& start_prob, const Matrix& trans_mat, const Matrix& means, const Matrix& variances) {
+            if (start_prob.size() != N || trans_mat.rows() != N || trans_mat.cols() != N ||
+                means.rows() != N || means.cols() != D || variances.rows() != N * D || variances.cols() != D) {
+                return false;
+            }
+
+            std::array<FeatureMatrix, N> inv_chol;
+            std::array<Scalar, N> log_norm;
+            for (int i = 0; i < N; ++i) {
+                FeatureMatrix cov = variances.block(i * D, 0, D, D);
+                Eigen::LLT<FeatureMatrix> llt(cov);
+                if (llt.info() != Eigen::Success) return false;
+
+                FeatureMatrix L = llt.matrixL();
+                inv_chol[i] = L.template triangularView<Eigen::Lower>().solve(FeatureMatrix::Identity());
+
+                Scalar log_det = 2.0 * L.diagonal().array().log().sum();
+                log_norm[i] = -0.5 * (D * std::log(2 * M_PI) + log_det);
+            }
+
+            for (int i = 0; i < N; ++i) {
+                log_start_(i) = std::log(start_prob(i));
+                means_[i] = means.row(i).transpose();
+                inv_chol_[i] = inv_chol[i];
+                log_norm_[i] = log_norm[i];
+                for (int j = 0; j < N; ++j) {
+                    // Same floor as the dynamic Viterbi
+                    log_trans_(i, j) = std::log(trans_mat(i, j) + 1e-9);
+                }
+            }
+            return true;
+        }
+
+        // Load the parameters of a dynamic detector with matching dimensions
+        bool setParameters(const HMMRegimeDetector& model) {
+            return setParameters(model.getStartProb(), model.getTransitionMatrix(), model.getMeans(), model.getVariances());
+        }
+
+        // Log-likelihood of x under one state
+        Scalar logEmissionProb(int state, const FeatureVector& x) const {
+            FeatureVector y = inv_chol_[state].template triangularView<Eigen::Lower>() * (x - means_[state]);
+            return log_norm_[state] - 0.5 * y.squaredNorm();
+        }
+
+        // Log-likelihood of x under every state
+        void logEmissions(const FeatureVector& x, StateVector& out) const {
+            for (int i = 0; i < N; ++i) out(i) = logEmissionProb(i, x);
+        }
+
+        /**
+         * @brief Viterbi decoding, O(T * N^2) with stack-resident state vectors.
+         *
+         * @param observations Matrix of shape (Time x D)
+         * @return std::vector<int> Most likely state sequence
+         */
+        std::vector<int> predictStates(const Matrix& observations) const {
+            const long T = observations.rows();
+            if (T == 0 || observations.cols() != D) return {};
+
+            std::vector<std::array<uint8_t, N>> psi(T);
+            StateVector delta, next, log_emit;
+            FeatureVector x;
+
+            x = observations.row(0).transpose();
+            logEmissions(x, log_emit);
+            delta = log_start_ + log_emit;
+
+            for (long t = 1; t < T; ++t) {
+                x = observations.row(t).transpose();
+                logEmissions(x, log_emit);
+                for (int j = 0; j < N; ++j) {
+                    Scalar max_prob = -std::numeric_limits<Scalar>::infinity();
+                    int best_prev = 0;
+                    for (int i = 0; i < N; ++i) {
+                        Scalar prob = delta(i) + log_trans_(i, j);
+                        if (prob > max_prob) {
+                            max_prob = prob;
+                            best_prev = i;
+                        }
+                    }
+                    next(j) = max_prob + log_emit(j);
+                    psi[t][j] = static_cast<uint8_t>(best_prev);
+                }
+                delta = next;
+            }
+
+            std::vector<int> states(T);
+            int best_final = 0;
+            for (int i = 1; i < N; ++i) {
+                if (delta(i) > delta(best_final)) best_final = i;
+            }
+            states[T - 1] = best_final;
+            for (long t = T - 2; t >= 0; --t) {
+                states[t] = psi[t + 1][states[t + 1]];
+            }
+            return states;
+        }
+
+    private:
+        StateVector log_start_;
+        StateMatrix log_trans_;
+        std::array<FeatureVector, N> means_;
+        std::array<FeatureMatrix, N> inv_chol_; // L^-1 with cov = L L^T
+        std::array<Scalar, N> log_norm_;        // -0.5 * (D log(2 pi) + log|cov|)
+    };
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Types.hpp"
+#include "HARModel.hpp"
+#include <array>
+#include <cstddef>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class HARForecaster
+     * @brief Stateful next-day HAR-RV-J forecaster for live data.
+     *
+     * Keeps the last 23 daily RVs in a ring buffer together with rolling weekly
+     * (lags 1-5) and monthly (lags 1-22) sums, so each new (RV, RJ) pair yields the
+     * next-day forecast in O(1) time, without re-scanning or copying the history.
+     *
+     * After n updates, forecast() equals HARModel::predict on the first n values
+     * (up to floating-point rounding; the sums are re-anchored every 22 days).
+     */
+    class HARForecaster {
+    public:
+        // Coefficients as [Intercept, Daily, Weekly, Monthly, Jumps]
+        explicit HARForecaster(const Vector& coefficients);
+
+        // Uses the coefficients of a fitted model (forecasts 0.0 if it is not fitted)
+        explicit HARForecaster(const HARModel& model);
+
+        /**
+         * @brief Append the RV and RJ of the day that just closed.
+         *
+         * @return Scalar Forecast of the next day's RV (0.0 until 23 days are available)
+         */
+        Scalar update(Scalar rv, Scalar rj);
+
+        // Forecast for the day after the last update
+        Scalar forecast() const;
+
+        // Regressors [1, RV_d, RV_w, RV_m, RJ_d] of the last update; false until ready
+        bool features(Eigen::Matrix<Scalar, 5, 1>& x) const;
+
+        // Swap in refitted coefficients; the history is kept
+        void setCoefficients(const Vector& coefficients);
+
+        // Clear the history (coefficients are kept)
+        void reset();
+
+        // True once enough history is available for a forecast
+        bool isReady() const { return n_ >= kHistory; }
+
+        // Number of days seen since the last reset
+        size_t count() const { return n_; }
+
+    private:
+        static constexpr size_t kHistory = 23; // Today plus 22 lags
+
+        Eigen::Matrix<Scalar, 5, 1> coefficients_;
+        bool is_fitted_;
+
+        std::array<Scalar, kHistory> rv_ring_; // rv[t] at slot t % 23
+        size_t n_;
+        Scalar sum_w_;  // rv[t-1] + ... + rv[t-5]
+        Scalar sum_m_;  // rv[t-1] + ... + rv[t-22]
+        Scalar rj_last_;
+    };
+
+}
@@ -5,6 +5,15 @@
 
 namespace AdaptiveExec {
 
+    // Columnar daily history of many symbols.
+    // Symbol s occupies rv/rj[offsets[s], offsets[s+1]); offsets has n_symbols + 1 entries.
+    struct HARPanel {
+        const Scalar* rv;
+        const Scalar* rj;
+        const size_t* offsets;
+        size_t n_symbols;
+    };
+
     class HARModel {
     public:
         HARModel();
@@ -13,21 +22,36 @@ namespace AdaptiveExec {
         // rv: Realized Variance series
         // rj: Realized Jumps series
         // returns R-squared
-        double fit(const Vector& rv, const Vector& rj);
+        double fit(const VectorView& rv, const VectorView& rj);
 
         // Predict next day volatility
         // current_rv: RV series up to today
         // current_rj: RJ series up to today
-        Scalar predict(const Vector& rv, const Vector& rj);
+        // Accepts any contiguous view (e.g. rv.head(t+1)) without copying.
+        // Needs at least 23 days (today plus 22 lags); for day-by-day use see HARForecaster.
+        Scalar predict(const VectorView& rv, const VectorView& rj);
+
+        // Multi-horizon forecasts for a whole universe in one vectorized pass.
+        // coefficients: one row [Intercept, Daily, Weekly, Monthly, Jumps] per symbol.
+        // horizons: forecast horizons in days (e.g. {1, 5, 22}).
+        // Returns (n_symbols x horizons) with entry (s, k) = forecast of RV on day T + horizons[k],
+        // where T is the last day of symbol s. Beyond one day the HAR recursion is iterated on its
+        // own forecasts, with future RJ set to the trailing 22-day mean RJ. Symbols with fewer
+        // than 23 days (and horizons < 1) give 0.0.
+        static Matrix forecastBatch(const HARPanel& panel, const Matrix& coefficients,
+                                    const std::vector<int>& horizons);
 
         Vector getCoefficients() const;
+        bool isFitted() const { return is_fitted_; }
 
     private:
+        friend class HARWalkForward;
+
         Vector coefficients_; // [Intercept, Daily, Weekly, Monthly, Jumps]
         bool is_fitted_;
 
         // Helper to create feature matrix [1, RV_d, RV_w, RV_m, RJ_d]
-        std::pair<Matrix, Vector> createFeatures(const Vector& rv, const Vector& rj);
+        std::pair<Matrix, Vector> createFeatures(const VectorView& rv, const VectorView& rj);
     };
 
 }
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Types.hpp"
+#include "HARForecaster.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class HAROnlineFitter
+     * @brief Recursive least-squares (RLS) estimation of the HAR-RV-J coefficients.
+     *
+     * Instead of rebuilding the design matrix and re-running a QR on every refit
+     * (HARModel::fit), each new day adds one regression sample and updates the
+     * 5 coefficients and the inverse Gram matrix P = (X^T X)^-1 in O(p^2):
+     *
+     *   k = P x / (lambda + x^T P x),  theta += k (y - x^T theta),  P = (P - k x^T P) / lambda
+     *
+     * Three modes:
+     *  - expanding window (forgetting = 1, window = 0): matches HARModel::fit on all days,
+     *  - exponential forgetting (forgetting < 1): sample weights lambda^age,
+     *  - sliding window (window = W > 0): the oldest sample is removed with the matching
+     *    rank-one downdate, so the result matches HARModel::fit on the last W samples.
+     *
+     * The recursion starts once the first samples give a non-singular X^T X (solved
+     * directly, "initialise from the first batch"). The weighted sums X^T X, X^T y, y^T y
+     * are kept alongside, which gives R^2 in O(p^2) and lets P and theta be re-anchored
+     * every few hundred updates so add/remove rounding cannot accumulate.
+     */
+    class HAROnlineFitter {
+    public:
+        /**
+         * @brief Construct a new online fitter.
+         *
+         * @param forgetting Exponential forgetting factor lambda in (0, 1] (ignored when window > 0)
+         * @param window Number of most recent samples to fit on (0 = all, otherwise at least 5)
+         */
+        HAROnlineFitter(Scalar forgetting = 1.0, size_t window = 0);
+
+        /**
+         * @brief Append the RV and RJ of the day that just closed.
+         *
+         * Once 23 days of history exist, the previous day's regressors and today's RV form
+         * a new sample (same samples as HARModel::createFeatures).
+         *
+         * @return true if the coefficients were updated
+         */
+        bool update(Scalar rv, Scalar rj);
+
+        /**
+         * @brief Feed a whole history day by day (e.g., the initial training window).
+         *
+         * @return Scalar R-squared after the last day
+         */
+        Scalar fit(const VectorView& rv, const VectorView& rj);
+
+        // Clear samples, coefficients and history
+        void reset();
+
+        // Next-day forecast with the current coefficients (0.0 until fitted)
+        Scalar forecast() const;
+
+        // [Intercept, Daily, Weekly, Monthly, Jumps] (zero until fitted)
+        Vector getCoefficients() const { return theta_; }
+
+        // R-squared of the current (weighted / windowed) fit
+        Scalar rSquared() const;
+
+        bool isFitted() const { return is_fitted_; }
+
+        // Number of samples in the current fit (all samples for the expanding/forgetting modes)
+        size_t sampleCount() const { return n_samples_; }
+
+    private:
+        using Vec5 = Eigen::Matrix<Scalar, 5, 1>;
+        using Mat5 = Eigen::Matrix<Scalar, 5, 5>;
+
+        static constexpr size_t kReanchorEvery = 256;
+
+        void addSample(const Vec5& x, Scalar y);
+        void removeSample(const Vec5& x, Scalar y);
+
+        // Recompute P and theta directly from X^T X and X^T y; false while X^T X is singular
+        bool reanchor();
+
+        Scalar lambda_;
+        size_t window_;
+
+        HARForecaster features_;     // Rolling daily / weekly / monthly regressors
+        Vec5 x_prev_;                // Regressors of the previous day
+        bool has_prev_;
+
+        // Weighted sufficient statistics
+        Mat5 xtx_;
+        Vec5 xty_;
+        Scalar yty_;
+        Scalar sum_y_;
+        Scalar weight_;              // Sum of weights (n for lambda = 1)
+
+        // RLS state
+        Vec5 theta_;
+        Mat5 P_;
+        bool is_fitted_;
+        size_t n_samples_;
+        size_t total_samples_;
+        size_t since_anchor_;
+
+        // Sliding window: samples in arrival order (ring of window_ entries)
+        std::vector<Vec5> win_x_;
+        std::vector<Scalar> win_y_;
+    };
+
+}
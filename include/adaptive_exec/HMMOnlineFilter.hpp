@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Types.hpp"
+#include "HMMRegimeDetector.hpp"
+#include <vector>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class HMMOnlineFilter
+     * @brief Stateful forward filter for live regime inference, one observation per bar.
+     * 
+     * Unlike HMMRegimeDetector::predictStates / predictProba, which rerun over the whole
+     * observation matrix, update() advances the forward recursion by one step:
+     * O(N^2 + N * D^2) per bar and no heap allocation after construction.
+     * 
+     * Optional fixed-lag smoothing: with lag L > 0, the filter also reports
+     * P(S_{t-L} | x_1..x_t), trading L bars of delay for more stable regime labels.
+     * The backward pass over the last L bars costs O(L * N^2) per update.
+     */
+    class HMMOnlineFilter {
+    public:
+        /**
+         * @brief Construct a filter from a parameterised detector (parameters are copied).
+         * 
+         * @param model Detector with parameters already set
+         * @param smoothing_lag Fixed-lag smoothing delay in bars (0 = filtering only)
+         */
+        explicit HMMOnlineFilter(const HMMRegimeDetector& model, int smoothing_lag = 0);
+
+        /**
+         * @brief Incorporate the next observation.
+         * 
+         * @param x Feature row of the newest bar (size: n_features)
+         * @return const Vector& Filtered posterior P(S_t | x_1..x_t)
+         */
+        const Vector& update(const RowVectorView& x);
+
+        /**
+         * @brief Restart from the initial state distribution (e.g., new symbol or session).
+         */
+        void reset();
+
+        // Filtered posterior of the latest bar and its MAP state
+        const Vector& posterior() const { return alpha_; }
+        int currentState() const;
+
+        // Fixed-lag smoothed posterior of bar t - lag (valid once hasSmoothed())
+        bool hasSmoothed() const { return lag_ > 0 && n_obs_ > lag_; }
+        const Vector& smoothedPosterior() const { return smoothed_; }
+        int smoothedState() const;
+
+        int lag() const { return lag_; }
+        long count() const { return n_obs_; }
+
+        // log P(x_1..x_t) accumulated so far
+        Scalar logLikelihood() const { return log_likelihood_; }
+
+    private:
+        int n_states_;
+        int n_features_;
+        int lag_;
+
+        // Model parameters (copied)
+        Vector start_prob_;
+        Matrix trans_mat_;
+        Matrix means_;
+        std::vector<Matrix> precision_mats_;
+        Vector log_dets_;
+        Scalar log_norm_const_;
+
+        // Filter state
+        long n_obs_;
+        Vector alpha_;
+        Scalar log_likelihood_;
+
+        // Preallocated work buffers
+        Vector diff_;
+        Vector tmp_;
+        Vector emit_;
+        Vector pred_;
+
+        // Fixed-lag smoothing: ring of the last lag + 1 filtered posteriors and
+        // scaled emission likelihoods (column k holds bar t with t % (lag + 1) == k)
+        Matrix alpha_hist_;
+        Matrix emit_hist_;
+        Vector beta_;
+        Vector beta_tmp_;
+        Vector smoothed_;
+
+        void smooth();
+    };
+
+}
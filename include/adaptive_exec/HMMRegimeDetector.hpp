@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Types.hpp"
+#include "utils/ThreadPool.hpp"
+#include <cstdint>
 #include <vector>
 
 namespace AdaptiveExec {
@@ -35,6 +37,14 @@ namespace AdaptiveExec {
          * @param trans_mat Transition probability matrix (n_states x n_states)
          * @param means Mean vectors for each state (n_states x n_features)
          * @param variances Covariance matrices (stacked: (n_states * n_features) x n_features)
+         * 
+         * Structurally sparse or banded transition matrices (at most half of the entries
+         * non-zero) are also stored in compressed form. The forward-backward recursions then
+         * cost O(N + nnz) per step and the Viterbi step O(N log N + nnz) instead of O(N^2).
+         * 
+         * Updates the model in place and must not race with inference on the same object.
+         * To recalibrate a live model, build a new detector and swap it in through
+         * SnapshotPublisher<HMMRegimeDetector> (utils/SnapshotPublisher.hpp).
          */
         void setParameters(const Vector& start_prob, const Matrix& trans_mat, const Matrix& means, const Matrix& variances);
 
@@ -43,33 +53,114 @@ namespace AdaptiveExec {
          * 
          * Uses the Viterbi Algorithm (Dynamic Programming).
          * Time Complexity: O(T * N^2), where T is time steps and N is number of states.
+         * Memory: one back-pointer per (time, state) plus two delta rows. Back-pointers are
+         * uint8 up to 256 states, uint16 up to 65536 and int32 beyond.
          * 
          * @param observations Matrix of shape (Time x Features)
          * @return std::vector<int> Sequence of state indices (0 to n_states-1)
          */
-        std::vector<int> predictStates(const Matrix& observations);
+        std::vector<int> predictStates(const Matrix& observations) const;
 
         /**
-         * @brief Calculate posterior state probabilities.
+         * @brief Memory-bounded Viterbi decoding for very long sequences.
+         * 
+         * The forward pass keeps a single delta row and stores it as a checkpoint every
+         * K steps. Backtracking then replays one segment at a time from its checkpoint,
+         * rebuilding back-pointers for that segment only. Memory is O((T / K + K) * N)
+         * instead of O(T * N), at the cost of a second forward pass.
          * 
-         * Uses the Forward algorithm logic to compute P(State_t | Observations).
+         * The replay uses the same recursion as predictStates, so the path is identical.
+         * 
+         * @param observations Matrix of shape (Time x Features)
+         * @param checkpoint_interval K (0 = ceil(sqrt(T)), which minimises memory)
+         * @return std::vector<int> Sequence of state indices (0 to n_states-1)
+         */
+        std::vector<int> predictStatesCheckpointed(const Matrix& observations, long checkpoint_interval = 0) const;
+
+        /**
+         * @brief Calculate smoothed posterior state probabilities P(State_t | all Observations).
+         * 
+         * Emissions for the whole sequence are evaluated at once (see computeLogEmissions),
+         * then a log-space forward-backward pass runs with a max-shifted log-sum-exp per step,
+         * so long, low-likelihood sequences do not underflow.
          * 
          * @param observations Matrix of shape (Time x Features)
          * @return Matrix Probabilities of shape (Time x States)
          */
-        Matrix predictProba(const Matrix& observations);
+        Matrix predictProba(const Matrix& observations) const;
 
         /**
-         * @brief Train the model parameters (Placeholder).
+         * @brief Viterbi-decode many sequences (e.g., one per symbol) with these parameters.
          * 
-         * In a full implementation, this would use the Baum-Welch (EM) algorithm.
-         * Currently used for interface compatibility.
+         * Sequences are spread across the pool with work-stealing; precision matrices,
+         * log-determinants and transition scores are shared read-only, and each worker
+         * reuses its own back-pointer buffer.
          * 
-         * @param observations Training data
+         * @param sequences One (Time x Features) matrix per symbol
+         * @param states Output, the paths concatenated in sequence order (resized to the
+         *               total number of rows, no reallocation when reused)
+         * @param pool Worker pool
          */
-        void fit(const Matrix& observations);
+        void predictStatesBatch(const std::vector<Matrix>& sequences, std::vector<int>& states,
+                                ThreadPool& pool = ThreadPool::global()) const;
+
+        /**
+         * @brief Smoothed posteriors for many sequences with these parameters.
+         * 
+         * @param sequences One (Time x Features) matrix per symbol
+         * @param proba Output, the (Time x States) posteriors stacked in sequence order
+         *              (resized to total rows x States, no reallocation when reused)
+         * @param pool Worker pool
+         */
+        void predictProbaBatch(const std::vector<Matrix>& sequences, Matrix& proba,
+                               ThreadPool& pool = ThreadPool::global()) const;
+
+        /**
+         * @brief Train the model parameters on a single sequence (Baum-Welch / EM).
+         * 
+         * @see fit(const std::vector<Matrix>&, int, Scalar, ThreadPool&)
+         * @return Scalar Final log-likelihood of the training data
+         */
+        Scalar fit(const Matrix& observations, int max_iter = 100, Scalar tol = 1e-4);
+
+        /**
+         * @brief Train the model parameters on many independent sequences (Baum-Welch / EM).
+         * 
+         * E-step: scaled forward-backward per sequence, run in parallel across the pool.
+         * Per-sequence sufficient statistics are reduced in sequence order, so the result
+         * is bitwise identical for any thread count.
+         * M-step: start/transition probabilities, means and full covariances
+         * (with a small ridge on the diagonal).
+         * 
+         * If parameters with a matching feature count were set before, they are used as
+         * the starting point; otherwise states are initialised from quantiles of the
+         * first feature.
+         * 
+         * Empty sequences are skipped. If the non-empty sequences disagree on the number of
+         * features, nothing is fitted and 0.0 is returned with the parameters unchanged.
+         * 
+         * @param sequences One (Time x Features) matrix per symbol / year
+         * @param max_iter Maximum number of EM iterations
+         * @param tol Stop when the log-likelihood improves by less than tol
+         * @param pool Worker pool for the E-step
+         * @return Scalar Final total log-likelihood
+         */
+        Scalar fit(const std::vector<Matrix>& sequences, int max_iter = 100, Scalar tol = 1e-4,
+                   ThreadPool& pool = ThreadPool::global());
+
+        int getNumStates() const { return n_states_; }
+        int getNumFeatures() const { return n_features_; }
+        const Vector& getStartProb() const { return start_prob_; }
+        const Matrix& getTransitionMatrix() const { return trans_mat_; }
+        const Matrix& getMeans() const { return means_; }
+        const Matrix& getVariances() const { return variances_; }
+
+        // True when the recursions run on the compressed transition matrix
+        bool usesSparseTransitions() const { return use_sparse_; }
 
     private:
+        friend class HMMOnlineFilter;
+
         int n_states_;
         int n_features_;
         
@@ -80,13 +171,57 @@ namespace AdaptiveExec {
         
         // Precomputed for speed
         std::vector<Matrix> precision_mats_; // Inverse of covariances
+        std::vector<Matrix> chol_factors_; // Lower Cholesky factors L (cov = L L^T)
         Vector log_dets_; // Log determinants of covariances
+        Matrix log_trans_; // log(A + 1e-9), Viterbi transition scores
+        SparseMatrix trans_sparse_; // Non-zeros of A; column j = predecessors of state j
+        bool use_sparse_ = false;
+
+        // Viterbi initialisation: delta_0(i) = log pi_i + log P(x_0 | i)
+        void viterbiInit(const RowVector& x, Vector& delta) const;
+
+        // Full Viterbi decode of a non-empty sequence into states[0, T), psi is reused scratch.
+        // Index is the back-pointer type (see predictStates), wide enough for n_states_ - 1.
+        template <typename Index>
+        void viterbiDecode(const Matrix& observations, int* states, std::vector<Index>& psi) const;
+
+        // Checkpointed decode (see predictStatesCheckpointed) with checkpoint interval K
+        template <typename Index>
+        void viterbiDecodeCheckpointed(const Matrix& observations, long K, int* states,
+                                       std::vector<Index>& psi) const;
+
+        // One Viterbi step: next(j) = max_i prev(i) + log A(i, j) + log P(x | j), argmax into psi_row.
+        // On the sparse path only the predecessors of j are scanned; the structurally zero
+        // entries all score prev(i) + log(1e-9), and the best of them comes from one sort of
+        // those scores per step, so a step costs O(N log N + nnz) rather than O(N^2).
+        template <typename Index>
+        void viterbiStep(const RowVector& x, const Vector& prev, Vector& next, Index* psi_row) const;
 
         /**
          * @brief Compute Log-Likelihood of an observation given a state.
          * Uses precomputed precision matrices for O(D^2) efficiency.
          */
-        Scalar logEmissionProb(int state, const RowVector& x);
+        Scalar logEmissionProb(int state, const RowVector& x) const;
+
+        /**
+         * @brief Log-emission matrix for a whole sequence.
+         * 
+         * Blocked over rows: for each state, a block of centred observations is whitened with
+         * one triangular solve against the Cholesky factor (L^-1 (X - mu)^T), so the
+         * Mahalanobis terms come out of a level-3 kernel instead of T separate quadratic forms.
+         * 
+         * @return Matrix Shape (Time x States), entry (t, i) = log P(x_t | S_t = i)
+         */
+        Matrix computeLogEmissions(const Matrix& observations) const;
+
+        /**
+         * @brief Log-space forward-backward on a log-emission matrix.
+         * 
+         * @param log_emit (Time x States) log-emission matrix
+         * @param log_gamma Output smoothed log posteriors (Time x States)
+         * @return Scalar Log-likelihood of the sequence
+         */
+        Scalar forwardBackwardLog(const Matrix& log_emit, Matrix& log_gamma) const;
     };
 
 }
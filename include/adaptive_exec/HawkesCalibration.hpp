@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Types.hpp"
+#include "HawkesModel.hpp"
+#include "utils/ThreadPool.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    // Maximum-likelihood estimate of a univariate exponential Hawkes process
+    struct HawkesFitResult {
+        double mu;
+        double alpha;
+        double beta;
+        double log_likelihood;
+        int iterations;       // BFGS iterations of the winning start
+        bool converged;
+
+        // Model with the fitted parameters
+        HawkesModel model() const { return HawkesModel(mu, alpha, beta); }
+    };
+
+    /**
+     * @class HawkesCalibrator
+     * @brief Maximum-likelihood calibration of HawkesModel (mu, alpha, beta).
+     *
+     * Log-likelihood on [0, T] with intensity lambda(t) = mu + alpha * sum exp(-beta (t - t_i)):
+     * \f[
+     * \log L = \sum_i \log \lambda(t_i) - \mu T - \frac{\alpha}{\beta} \sum_i \left(1 - e^{-\beta (T - t_i)}\right)
+     * \f]
+     *
+     * Both the likelihood and its analytic gradient come from the same O(N) recursion
+     * used by HawkesModel::addEvent:
+     *   A_i = e^{-beta dt_i} (1 + A_{i-1}),   B_i = e^{-beta dt_i} (B_{i-1} + dt_i (1 + A_{i-1}))
+     * where A_i = sum_{j<i} e^{-beta (t_i - t_j)} and B_i = -dA_i / dbeta. The compensator sums
+     * follow from the final A_N and B_N, so one exponential per event is needed. Events are
+     * processed in blocks: exponentials, logs and reciprocals are vectorized, only the A/B
+     * recursion itself is sequential.
+     *
+     * The optimizer is a projected BFGS in log-parameters (positivity for free) with box
+     * bounds and the stationarity constraint alpha / beta <= 0.999. Multi-start runs in
+     * parallel across the pool and the best likelihood wins.
+     */
+    class HawkesCalibrator {
+    public:
+        /**
+         * @brief Log-likelihood of sorted event times on [0, T].
+         *
+         * @param times Event timestamps, ascending, within [0, T]
+         * @param n Number of events
+         * @param T End of the observation window
+         * @param grad Optional output: d logL / d(mu, alpha, beta)
+         * @return double Log-likelihood (-inf for non-positive parameters)
+         */
+        static double logLikelihood(const double* times, size_t n, double T,
+                                    double mu, double alpha, double beta, double* grad = nullptr);
+
+        static double logLikelihood(const std::vector<double>& times, double T,
+                                    double mu, double alpha, double beta, double* grad = nullptr);
+
+        /**
+         * @brief Fit (mu, alpha, beta) by maximum likelihood.
+         *
+         * Starting points are a deterministic grid over branching ratio alpha / beta and decay
+         * rate beta (relative to the mean event rate N / T). For long sessions the starts are
+         * screened on the leading 65536 events (itself an exact Hawkes likelihood) and only the
+         * winner is refined on the full sample.
+         *
+         * @param times Event timestamps, ascending, within [0, T]
+         * @param T End of the observation window (e.g., session length)
+         * @param n_starts Number of starting points
+         * @param max_iter BFGS iterations per start
+         * @param pool Worker pool for the starts
+         * @return HawkesFitResult Best fit (log_likelihood = -inf if fewer than 2 events)
+         */
+        static HawkesFitResult fit(const double* times, size_t n, double T, int n_starts = 8,
+                                   int max_iter = 200, ThreadPool& pool = ThreadPool::global());
+
+        static HawkesFitResult fit(const std::vector<double>& times, double T, int n_starts = 8,
+                                   int max_iter = 200, ThreadPool& pool = ThreadPool::global());
+    };
+
+}
@@ -61,6 +61,10 @@ namespace AdaptiveExec {
          */
         void reset();
 
+        double getBaseline() const { return mu_; }
+        double getAlpha() const { return alpha_; }
+        double getBeta() const { return beta_; }
+
     private:
         double mu_;
         double alpha_;
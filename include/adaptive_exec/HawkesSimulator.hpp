@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Types.hpp"
+#include "utils/ThreadPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    // Circuit-breaker statistics of one simulated session
+    struct HawkesSessionStats {
+        size_t n_events;
+        size_t n_triggers;      // Events whose post-jump intensity exceeded the threshold
+        double max_intensity;   // Largest post-jump intensity (mu if no events)
+        double first_trigger;   // Time of the first trigger (-1.0 if none)
+    };
+
+    /**
+     * @class HawkesSimulator
+     * @brief Exact event-stream simulation of the exponential Hawkes process of HawkesModel.
+     *
+     * Uses the exact decomposition of the exponential kernel (Dassios & Zhao) instead of
+     * thinning, so there are no rejected candidates. With excitation E = lambda - mu just after
+     * the last event, the next arrival is the earlier of
+     *   - a baseline arrival:    S1 = -ln(U1) / mu
+     *   - an excited arrival:    S2 = -ln(1 + beta ln(U2) / E) / beta  (never if the log argument <= 0)
+     * and E decays by e^{-beta S} then jumps by alpha. Each event costs two uniforms and
+     * three transcendentals.
+     *
+     * Monte Carlo sessions run in parallel; session s draws from its own xoshiro256** stream
+     * seeded by SplitMix64(seed, s). Results are therefore identical for any thread count.
+     */
+    class HawkesSimulator {
+    public:
+        /**
+         * @brief Construct a new simulator.
+         *
+         * @param baseline (mu) Background intensity rate (events per time unit)
+         * @param alpha Excitation magnitude (jump in intensity per event)
+         * @param beta Decay rate
+         */
+        HawkesSimulator(double baseline, double alpha, double beta);
+
+        /**
+         * @brief Simulate one session on [0, T].
+         *
+         * @param T Session length
+         * @param seed Stream seed
+         * @param times Output event times (cleared first)
+         * @return size_t Number of events
+         */
+        size_t simulate(double T, uint64_t seed, std::vector<double>& times) const;
+
+        // One session reduced to circuit-breaker statistics (same events as simulate() with this seed)
+        HawkesSessionStats simulateSession(double T, double threshold, uint64_t seed) const;
+
+        /**
+         * @brief Simulate many independent sessions in parallel.
+         *
+         * @param n_sessions Number of sessions
+         * @param T Session length
+         * @param threshold Circuit-breaker intensity limit
+         * @param seed Base seed; session s uses streamSeed(seed, s)
+         * @param pool Worker pool
+         * @return std::vector<HawkesSessionStats> One entry per session
+         */
+        std::vector<HawkesSessionStats> simulateSessions(size_t n_sessions, double T, double threshold,
+                                                         uint64_t seed, ThreadPool& pool = ThreadPool::global()) const;
+
+        // Seed of stream s derived from a base seed (SplitMix64)
+        static uint64_t streamSeed(uint64_t seed, uint64_t stream);
+
+    private:
+        template <typename OnEvent>
+        void run(double T, uint64_t seed, OnEvent&& on_event) const;
+
+        double mu_;
+        double alpha_;
+        double beta_;
+    };
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Types.hpp"
+#include <cstddef>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class MultivariateHawkesModel
+     * @brief D-dimensional exponential Hawkes process (e.g., buy/sell flow, correlated instruments).
+     *
+     * Intensity of dimension i:
+     * \f[
+     * \lambda_i(t) = \mu_i + \sum_j \sum_{t^j_k < t} \alpha_{ij} e^{-\beta_i (t - t^j_k)}
+     * \f]
+     * alpha(i, j) is the jump in lambda_i caused by an event in dimension j, and beta_i is
+     * the decay rate of the target dimension. With one decay per target, all past events
+     * collapse into a single excitation vector, so an event costs O(D):
+     * decay the vector to the new timestamp and add column j of alpha. Columns are contiguous
+     * (column-major storage), so both steps are straight vector operations.
+     *
+     * The process is stationary when the spectral radius of alpha(i, j) / beta_i is below 1.
+     *
+     * Const queries write nothing and may run concurrently with each other; addEvent() and
+     * reset() must not race with them.
+     */
+    class MultivariateHawkesModel {
+    public:
+        /**
+         * @brief Construct a new multivariate Hawkes model.
+         *
+         * @param baseline (mu) Background intensity per dimension (size D)
+         * @param alpha Excitation matrix (D x D), alpha(target, source)
+         * @param beta Decay rate per target dimension (size D)
+         */
+        MultivariateHawkesModel(const Vector& baseline, const Matrix& alpha, const Vector& beta);
+
+        /**
+         * @brief Update the model with an event in one dimension.
+         *
+         * @param timestamp Time of the event (must be >= last event time)
+         * @param dim Dimension of the event, in [0, D)
+         * @return double Intensity of dimension dim immediately after the event (0.0 for an invalid dim)
+         */
+        double addEvent(double timestamp, int dim);
+
+        // Feed a time-ordered batch of events
+        void addEvents(const double* timestamps, const int* dims, size_t n);
+
+        /**
+         * @brief All D intensities at a query time.
+         *
+         * @param timestamp Query time (must be >= last event time)
+         * @param out Output intensities (resized to D)
+         */
+        void getIntensity(double timestamp, Vector& out) const;
+
+        // Intensity of a single dimension at a query time (O(1))
+        double getIntensity(double timestamp, int dim) const;
+
+        // Sum of all intensities (e.g., total market activity across instruments)
+        double getTotalIntensity(double timestamp) const;
+
+        // True if any dimension exceeds the threshold
+        bool isCritical(double timestamp, double threshold) const;
+
+        // True if any dimension exceeds its own threshold (size D)
+        bool isCritical(double timestamp, const Vector& thresholds) const;
+
+        /**
+         * @brief Reset model state (e.g., for start of new trading day).
+         */
+        void reset();
+
+        // Spectral radius of alpha(i, j) / beta_i (branching ratio; < 1 for stationarity)
+        Scalar branchingRatio() const;
+
+        int dimension() const { return static_cast<int>(mu_.size()); }
+        const Vector& getBaseline() const { return mu_; }
+        const Matrix& getAlpha() const { return alpha_; }
+        const Vector& getBeta() const { return beta_; }
+
+    private:
+        // Excitation vector decayed from the last event to timestamp
+        void decayedExcitation(double timestamp, Vector& out) const;
+
+        Vector mu_;
+        Matrix alpha_;
+        Vector beta_;
+        bool uniform_beta_;      // One shared decay: a single exp per event
+
+        double last_event_time_;
+        Vector excite_;          // lambda - mu just after the last event
+    };
+
+}
@@ -10,6 +10,10 @@ namespace AdaptiveExec {
         // Compute CVaR at 95% confidence (alpha = 0.05)
         static Scalar computeCVaR(const std::vector<Scalar>& returns, Scalar alpha = 0.05);
 
+        // Zero-copy view. Partial selection of the tail (O(N)) in a per-thread scratch
+        // buffer that is reused across calls, so steady-state calls do not allocate.
+        static Scalar computeCVaR(const Scalar* returns, size_t n, Scalar alpha = 0.05);
+
         // Get position size multiplier based on regime
         static Scalar getRegimePositionSize(MarketRegime state, Scalar base_size = 1.0);
     };
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Types.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class StreamingVolatility
+     * @brief Tick-by-tick accumulator for the intraday realized measures.
+     *
+     * Maintains running sums so that RV, BV, MedRV, RJ and TSRV are available after
+     * every new return in O(1) time and O(1) memory, instead of re-running the batch
+     * functions of VolatilityEstimators on an ever-growing vector (O(N^2) per session).
+     *
+     * After n updates every getter returns the same value as the corresponding
+     * VolatilityEstimators::computeXX() call on the first n returns (the sums are
+     * accumulated in the same order, so results agree to the last bit).
+     */
+    class StreamingVolatility {
+    public:
+        /**
+         * @brief Construct a new streaming accumulator.
+         *
+         * @param K Subsampling step of the TSRV slow scale (same meaning as computeTSRV)
+         * @param annualization_factor Multiplier applied to every reported estimate
+         */
+        StreamingVolatility(int K = 5, Scalar annualization_factor = 1.0);
+
+        /**
+         * @brief Add the next intraday return.
+         *
+         * @param r Log return of the newest tick/bar
+         */
+        void update(Scalar r);
+
+        /**
+         * @brief Clear all accumulators (e.g., at the start of a new session).
+         */
+        void reset();
+
+        Scalar rv() const;
+        Scalar bv() const;
+        Scalar medRV() const;
+        Scalar rj() const;
+        Scalar tsrv() const;
+
+        // Number of returns seen since the last reset
+        size_t count() const { return n_; }
+
+    private:
+        int K_;
+        Scalar annualization_factor_;
+
+        size_t n_;
+        Scalar sum_sq_;       // Sum r_i^2 (RV and TSRV fast scale)
+        Scalar sum_abs_prod_; // Sum |r_i||r_{i-1}| (BV)
+        Scalar sum_med_sq_;   // Sum med(|r_i|, |r_{i-1}|, |r_{i-2}|)^2 (MedRV)
+        Scalar sum_sub_sq_;   // Sum of r_i^2 on the grid i = 0, K, 2K, ... (TSRV slow scale)
+
+        Scalar abs_prev1_;    // |r_{n-1}|
+        Scalar abs_prev2_;    // |r_{n-2}|
+    };
+
+    /**
+     * @class StreamingLeeMykland
+     * @brief Per-tick Lee-Mykland jump statistic for live data.
+     *
+     * Keeps the last window_size absolute returns in a ring buffer together with a
+     * rolling bipower sum, so each new return is tested in O(1) time with no allocation
+     * after construction.
+     *
+     * For every index i >= window_size, update() returns the same statistic as
+     * VolatilityEstimators::computeLeeMykland (up to floating-point rounding). Earlier
+     * returns yield 0.0 since the local volatility window is not yet full.
+     */
+    class StreamingLeeMykland {
+    public:
+        /**
+         * @brief Construct a new streaming jump test.
+         *
+         * @param window_size Local window for instantaneous volatility (e.g., 16 to 270)
+         */
+        StreamingLeeMykland(size_t window_size = 16);
+
+        /**
+         * @brief Test the newest return against the local volatility of the previous window.
+         *
+         * @param r Log return of the newest tick/bar
+         * @return Scalar |r| / local_vol (statistic > ~3.0 implies a jump)
+         */
+        Scalar update(Scalar r);
+
+        /**
+         * @brief Clear the window (e.g., at the start of a new session).
+         */
+        void reset();
+
+        size_t count() const { return n_; }
+
+    private:
+        size_t window_size_;
+        std::vector<Scalar> abs_ring_; // |r| of the last window_size + 1 returns
+        size_t n_;
+        Scalar pair_sum_;              // Sum of adjacent |r| products inside the window
+    };
+
+}
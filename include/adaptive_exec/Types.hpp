@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <Eigen/SparseCore>
 #include <vector>
 
 namespace AdaptiveExec {
@@ -11,6 +12,16 @@ namespace AdaptiveExec {
     using Matrix = Eigen::MatrixXd;
     using RowVector = Eigen::RowVectorXd;
 
+    // Compressed sparse column matrix (column j lists its non-zero rows in order)
+    using SparseMatrix = Eigen::SparseMatrix<Scalar>;
+
+    // Non-owning read-only view: binds to a Vector, a contiguous segment/head()
+    // or an Eigen::Map over external memory without copying
+    using VectorView = Eigen::Ref<const Vector>;
+
+    // Non-owning view of one observation row (accepts strided rows of a column-major Matrix)
+    using RowVectorView = Eigen::Ref<const RowVector, 0, Eigen::InnerStride<>>;
+
     // Structure for daily market data
     struct MarketData {
         Scalar open;
@@ -5,6 +5,22 @@
 
 namespace AdaptiveExec {
 
+    // Full daily realized feature set produced by a single pass over the returns
+    struct VolatilityFeatures {
+        Scalar rv;
+        Scalar bv;
+        Scalar medrv;
+        Scalar rj;
+        Scalar tsrv;
+    };
+
+    // Noise-robust integrated variance estimators produced by a single pass
+    struct NoiseRobustFeatures {
+        Scalar tsrv;            // TSRV averaged over all K subsampling grids
+        Scalar msrv;            // Multi-scale RV over scales 1..M
+        Scalar realized_kernel; // Parzen realized kernel with bandwidth H
+    };
+
     class VolatilityEstimators {
     public:
         // Standard Realized Volatility (sum of squared returns)
@@ -26,10 +42,39 @@ namespace AdaptiveExec {
         // Returns a vector of t-statistics for each return.
         // Statistic > threshold (approx 3.0-3.5) implies a jump.
         // window_size: Local window for instantaneous volatility estimation (e.g., 16 to 270)
+        // Uses a rolling bipower sum, O(N) regardless of window_size.
         static std::vector<Scalar> computeLeeMykland(const std::vector<Scalar>& returns, size_t window_size = 16);
 
+        // Fused RV/BV/MedRV/RJ/TSRV in one vectorized pass (AVX-512 / AVX2 with scalar fallback).
+        // Reads the return array once, versus three times for computeRV + computeBV + computeRJ.
+        // Matches the per-function results up to floating-point summation order.
+        static VolatilityFeatures computeFeatures(const std::vector<Scalar>& returns, int K = 5, Scalar annualization_factor = 1.0);
+
+        // Noisy-venue estimators in one linear pass (O(N * (M + H)) work independent of K,
+        // input read once; ring buffers live in a reused per-thread scratch buffer):
+        //  - TSRV over all K grids (Zhang, Mykland & Ait-Sahalia 2005), small-sample adjusted
+        //  - MSRV with the optimal weights over scales 1..M (Zhang 2006)
+        //  - Parzen realized kernel, gamma_0 + 2 * sum_h k(h / (H + 1)) * gamma_h
+        //    (Barndorff-Nielsen, Hansen, Lunde & Shephard 2008)
+        // computeTSRV keeps the single-grid notebook variant for backward compatibility.
+        static NoiseRobustFeatures computeNoiseRobust(const std::vector<Scalar>& returns, int K = 5, int M = 10, int H = 10, Scalar annualization_factor = 1.0);
+
+        // --- Zero-copy views (pointer + length) ---
+        // Same estimators over a borrowed slice, e.g. a window of a memory-mapped file,
+        // a ring buffer segment or an Eigen vector (v.data(), v.size()). No allocation.
+        static Scalar computeRV(const Scalar* returns, size_t n, Scalar annualization_factor = 1.0);
+        static Scalar computeBV(const Scalar* returns, size_t n, Scalar annualization_factor = 1.0);
+        static Scalar computeMedRV(const Scalar* returns, size_t n, Scalar annualization_factor = 1.0);
+        static Scalar computeRJ(const Scalar* returns, size_t n, Scalar annualization_factor = 1.0);
+        static Scalar computeTSRV(const Scalar* returns, size_t n, int K = 5, Scalar annualization_factor = 1.0);
+        static VolatilityFeatures computeFeatures(const Scalar* returns, size_t n, int K = 5, Scalar annualization_factor = 1.0);
+        static NoiseRobustFeatures computeNoiseRobust(const Scalar* returns, size_t n, int K = 5, int M = 10, int H = 10, Scalar annualization_factor = 1.0);
+
+        // Writes n statistics into the caller-provided buffer
+        static void computeLeeMykland(const Scalar* returns, size_t n, Scalar* statistics, size_t window_size = 16);
+
     private:
-        static Scalar sumSquares(const std::vector<Scalar>& data);
+        static Scalar sumSquares(const Scalar* data, size_t n);
     };
 
 }
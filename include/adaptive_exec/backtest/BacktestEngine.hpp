@@ -22,7 +22,7 @@ namespace AdaptiveExec {
         // Reset state
         void reset(Scalar initial_capital);
 
-        // Execute an order at a specific price
+        // Execute an order at a specific price (dropped while the kill switch is tripped)
         // Returns cost of transaction
         void executeOrder(int day, Scalar price, Scalar quantity, MarketRegime regime);
 
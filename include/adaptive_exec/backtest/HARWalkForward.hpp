@@ -0,0 +1,46 @@
+#pragma once
+
+#include "../Types.hpp"
+#include "../HARModel.hpp"
+#include "../utils/ThreadPool.hpp"
+#include <vector>
+
+namespace AdaptiveExec {
+
+    // Out-of-sample evaluation of one (symbol, estimation window) pair
+    struct WalkForwardResult {
+        size_t symbol;
+        size_t window;             // Estimation window in regression samples
+        size_t first_day;          // Day index (within the symbol) of realized[0]
+        std::vector<Scalar> forecast;
+        std::vector<Scalar> realized;
+        Scalar mse;
+        Scalar qlike;              // Mean of y/f - log(y/f) - 1 over days with f, y > 0
+    };
+
+    class HARWalkForward {
+    public:
+        /**
+         * @brief Rolling-window HAR refits with one-step-ahead forecasts.
+         *
+         * For every symbol of the panel and every window length W, the HAR-RV-J model is
+         * refit on the W most recent regression samples (same samples as HARModel::fit)
+         * and the next day is forecast, for every day with W samples of history.
+         *
+         * X^T X and X^T y slide with the window (one sample in, one out, re-anchored every
+         * W steps), so each step costs O(p^2) plus a 5x5 Cholesky solve instead of an
+         * O(W) refit. (symbol, window) pairs run in parallel across the pool.
+         *
+         * @param panel Daily RV/RJ histories
+         * @param windows Estimation window lengths (in samples, each at least 5)
+         * @param pool Worker pool
+         * @return One result per (symbol, window), symbol-major: index = s * windows.size() + w
+         */
+        static std::vector<WalkForwardResult> run(const HARPanel& panel, const std::vector<size_t>& windows,
+                                                  ThreadPool& pool = ThreadPool::global());
+
+        // Same evaluation for a single series
+        static WalkForwardResult run(const VectorView& rv, const VectorView& rj, size_t window);
+    };
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace AdaptiveExec {
+
+    // Risk sources that can halt trading (bit flags; several can be recorded)
+    enum class TripReason : uint32_t {
+        None = 0,
+        HawkesIntensity = 1u << 0,
+        CVaRBreach = 1u << 1,
+        JumpDetected = 1u << 2,
+        Manual = 1u << 3
+    };
+
+    /**
+     * @class KillSwitch
+     * @brief Process-wide trading halt that any risk source can trip.
+     *
+     * The state is one 32-bit word of trip reasons (0 = armed) on its own cache line:
+     *  - isTripped(): a single acquire load on the order path (a few ns, no stores, so
+     *    order threads do not contend with each other),
+     *  - trip(): fetch_or of the reason; the first tripper also records a timestamp.
+     *
+     * attachShared() moves the word into a POSIX shared-memory segment (shm_open + mmap),
+     * so every process on the host that attaches to the same name halts together. The
+     * segment keeps its state across attach/detach; reset() re-arms it for all processes.
+     *
+     * attachShared() / detachShared() must not race with trip() / isTripped() calls
+     * (attach at start-up, before order threads run).
+     */
+    class KillSwitch {
+    public:
+        KillSwitch();
+        ~KillSwitch();
+
+        KillSwitch(const KillSwitch&) = delete;
+        KillSwitch& operator=(const KillSwitch&) = delete;
+
+        // Process-wide instance used by ExecutionEngine and BacktestEngine
+        static KillSwitch& global();
+
+        // Order-path check
+        bool isTripped() const { return state_->word.load(std::memory_order_acquire) != 0; }
+
+        /**
+         * @brief Halt trading.
+         *
+         * @param reason Risk source (recorded alongside earlier reasons)
+         * @return true if this call moved the switch from armed to tripped
+         */
+        bool trip(TripReason reason = TripReason::Manual);
+
+        // Re-arm (clears the shared segment too when attached)
+        void reset();
+
+        // Bitwise OR of all TripReason values recorded since the last reset
+        uint32_t reasons() const { return state_->word.load(std::memory_order_acquire); }
+
+        bool hasReason(TripReason reason) const {
+            return (reasons() & static_cast<uint32_t>(reason)) != 0;
+        }
+
+        // steady_clock time of the first trip in ns (0 while armed)
+        int64_t tripTimeNs() const { return state_->trip_time_ns.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Mirror the switch into a named shared-memory segment (e.g., "/adaptive_exec_halt").
+         *
+         * A local trip recorded before attaching is carried over into the segment.
+         *
+         * @return false if the segment could not be created or mapped (state stays local)
+         */
+        bool attachShared(const std::string& name);
+
+        // Return to the process-local state (keeps the segment for other processes)
+        void detachShared();
+
+        bool isShared() const { return shared_ != nullptr; }
+
+        // Remove a named segment from the system (existing mappings stay valid)
+        static bool unlinkShared(const std::string& name);
+
+    private:
+        // Layout shared between processes: lock-free atomics only
+        struct alignas(64) State {
+            std::atomic<uint32_t> word;
+            std::atomic<int64_t> trip_time_ns;
+        };
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared kill switch needs lock-free atomics");
+        static_assert(std::atomic<int64_t>::is_always_lock_free, "shared kill switch needs lock-free atomics");
+
+        State local_;
+        State* shared_;
+        State* state_;   // &local_ or shared_
+    };
+
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class SnapshotPublisher
+     * @brief Epoch-based (RCU-style) publication of immutable snapshots.
+     *
+     * One or more writers publish complete, fully built objects (e.g., a recalibrated
+     * HMMRegimeDetector); readers on the live path pin the current snapshot for the
+     * duration of a read and never block or observe a half-updated object.
+     *
+     *  - read():    announce the current epoch in the reader's own cache-line slot, load
+     *               the snapshot pointer, clear the slot when the guard goes out of scope.
+     *               Wait-free: two atomic stores and two atomic loads.
+     *  - publish(): swap the pointer, advance the epoch, then wait until no reader is
+     *               still pinned to an older epoch before destroying the old snapshot.
+     *               Only the writer ever waits.
+     *
+     * Each reading thread registers once and keeps its slot id; a slot must not be
+     * used by two threads at the same time, nor hold two nested guards.
+     *
+     * @code
+     *   SnapshotPublisher<HMMRegimeDetector> models(std::move(initial));
+     *   int slot = models.registerReader();            // once per inference thread
+     *   {
+     *       auto model = models.read(slot);
+     *       states = model->predictStates(window);     // consistent parameter set
+     *   }
+     *   models.publish(std::move(recalibrated));       // from the calibration thread
+     * @endcode
+     */
+    template <typename T>
+    class SnapshotPublisher {
+    public:
+        /**
+         * @brief Pins one snapshot until destroyed.
+         */
+        class ReadGuard {
+        public:
+            ReadGuard(ReadGuard&& other) noexcept : slot_(other.slot_), ptr_(other.ptr_) {
+                other.slot_ = nullptr;
+            }
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+            ReadGuard& operator=(ReadGuard&&) = delete;
+
+            ~ReadGuard() {
+                if (slot_) slot_->store(kIdle, std::memory_order_release);
+            }
+
+            const T& operator*() const { return *ptr_; }
+            const T* operator->() const { return ptr_; }
+            const T* get() const { return ptr_; }
+
+        private:
+            friend class SnapshotPublisher;
+            ReadGuard(std::atomic<uint64_t>* slot, const T* ptr) : slot_(slot), ptr_(ptr) {}
+
+            std::atomic<uint64_t>* slot_;
+            const T* ptr_;
+        };
+
+        /**
+         * @brief Construct with an initial snapshot.
+         *
+         * @param initial First published object (must not be null)
+         * @param max_readers Number of reader slots
+         */
+        explicit SnapshotPublisher(std::unique_ptr<T> initial, size_t max_readers = 64)
+            : max_readers_(max_readers), slots_(new Slot[max_readers]),
+              n_registered_(0), epoch_(1), current_(initial.release()) {}
+
+        ~SnapshotPublisher() { delete current_.load(std::memory_order_acquire); }
+
+        SnapshotPublisher(const SnapshotPublisher&) = delete;
+        SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+        // Claim a reader slot for the calling thread; -1 if all slots are taken
+        int registerReader() {
+            size_t id = n_registered_.fetch_add(1, std::memory_order_relaxed);
+            if (id >= max_readers_) {
+                n_registered_.fetch_sub(1, std::memory_order_relaxed);
+                return -1;
+            }
+            return static_cast<int>(id);
+        }
+
+        // Pin the current snapshot (reader side, never blocks)
+        ReadGuard read(int reader) const {
+            std::atomic<uint64_t>& slot = slots_[reader].epoch;
+            // Announce before loading the pointer; seq_cst orders this store before the load
+            slot.store(epoch_.load(std::memory_order_acquire), std::memory_order_seq_cst);
+            return ReadGuard(&slot, current_.load(std::memory_order_seq_cst));
+        }
+
+        /**
+         * @brief Replace the published snapshot (writer side).
+         *
+         * New readers see the new object as soon as the pointer is swapped; the call returns
+         * once every reader pinned to the previous snapshot has released it and the previous
+         * snapshot has been destroyed.
+         */
+        void publish(std::unique_ptr<T> next) {
+            std::lock_guard<std::mutex> lock(writer_mutex_);
+            T* old = current_.exchange(next.release(), std::memory_order_seq_cst);
+            uint64_t new_epoch = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+            waitForReaders(new_epoch);
+            delete old;
+        }
+
+        // Current epoch: 1 + number of publish() calls
+        uint64_t epoch() const { return epoch_.load(std::memory_order_acquire); }
+
+    private:
+        static constexpr uint64_t kIdle = 0;
+
+        struct alignas(64) Slot {
+            std::atomic<uint64_t> epoch{kIdle};
+        };
+
+        // Grace period: every reader is idle or entered at new_epoch or later
+        void waitForReaders(uint64_t new_epoch) const {
+            size_t n = std::min(n_registered_.load(std::memory_order_acquire), max_readers_);
+            for (size_t r = 0; r < n; ++r) {
+                while (true) {
+                    uint64_t e = slots_[r].epoch.load(std::memory_order_seq_cst);
+                    if (e == kIdle || e >= new_epoch) break;
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        size_t max_readers_;
+        std::unique_ptr<Slot[]> slots_;
+        std::atomic<size_t> n_registered_;
+        alignas(64) std::atomic<uint64_t> epoch_;
+        alignas(64) std::atomic<T*> current_;
+        std::mutex writer_mutex_;
+    };
+
+}
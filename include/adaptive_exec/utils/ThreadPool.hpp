@@ -0,0 +1,85 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AdaptiveExec {
+
+    /**
+     * @class ThreadPool
+     * @brief Persistent worker pool with a work-stealing parallel-for.
+     *
+     * The index range of each parallelFor() is split evenly into one queue per worker.
+     * A worker pops grain-sized chunks from the front of its own queue and, once empty,
+     * steals the back half of another worker's remaining range. This keeps all cores
+     * busy when per-index cost is very uneven (e.g., symbols with 10^2 vs 10^6 ticks).
+     *
+     * The calling thread participates as worker 0. Nested parallelFor() calls made from
+     * inside a body run serially on the calling worker.
+     */
+    class ThreadPool {
+    public:
+        // body(begin, end, worker): process indices [begin, end) on worker id in [0, size())
+        using RangeFn = std::function<void(size_t, size_t, size_t)>;
+
+        /**
+         * @brief Construct a new pool.
+         *
+         * @param n_threads Total workers including the caller (0 = hardware concurrency)
+         */
+        explicit ThreadPool(size_t n_threads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Number of workers (including the calling thread)
+        size_t size() const { return n_workers_; }
+
+        /**
+         * @brief Run body over [0, n) in chunks of at most grain indices; blocks until done.
+         *
+         * The first exception thrown by a body is rethrown to the caller.
+         */
+        void parallelFor(size_t n, size_t grain, const RangeFn& body);
+
+        // Process-wide pool sized to the hardware
+        static ThreadPool& global();
+
+    private:
+        struct alignas(64) WorkQueue {
+            std::mutex mutex;
+            size_t begin = 0;
+            size_t end = 0;
+        };
+
+        void workerLoop(size_t worker);
+        void runWorker(size_t worker);
+        bool popLocal(size_t worker, size_t& begin, size_t& end);
+        bool steal(size_t thief);
+
+        size_t n_workers_;
+        std::vector<std::thread> threads_;
+        std::unique_ptr<WorkQueue[]> queues_;
+
+        std::mutex job_mutex_; // Serializes concurrent parallelFor() callers
+        std::mutex mutex_;
+        std::condition_variable cv_start_;
+        std::condition_variable cv_done_;
+        uint64_t generation_;
+        size_t active_;
+        bool stop_;
+
+        const RangeFn* body_;
+        size_t grain_;
+        std::exception_ptr error_;
+    };
+
+}
@@ -0,0 +1,164 @@
+#include "../include/adaptive_exec/AlmgrenChrissSolver.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace AdaptiveExec {
+
+    AlmgrenChrissSolver::AlmgrenChrissSolver(const std::vector<int>& cached_horizons) {
+        // Temporary impact follows ExecutionEngine::computeTransactionCosts (0.02 / 0.05 / 0.15);
+        // permanent impact is half of it, one shared risk aversion
+        params_[index(MarketRegime::LowVolatility)] = {0.005, 0.02, 0.01, 5.0};
+        params_[index(MarketRegime::Normal)] = {0.010, 0.05, 0.025, 5.0};
+        params_[index(MarketRegime::HighVolatility)] = {0.025, 0.15, 0.075, 5.0};
+
+        for (int k = 0; k < 3; ++k) {
+            offset_[k].assign(kMaxCachedHorizon + 1, -1);
+            setParameters(static_cast<MarketRegime>(k), params_[k]);
+        }
+        precompute(cached_horizons);
+    }
+
+    void AlmgrenChrissSolver::setParameters(MarketRegime regime, const AlmgrenChrissParams& params) {
+        const int k = index(regime);
+        params_[k] = params;
+
+        // cosh(kappa) = 1 + kappa~^2 / 2, kappa~^2 = lambda sigma^2 / eta~ (unit period).
+        // acosh(1 + x) = log1p(x + sqrt(x (x + 2))) stays accurate for small x.
+        // A non-positive eta~ (permanent impact dominating) has no interior optimum: fall back to TWAP.
+        Scalar eta_tilde = params.eta - 0.5 * params.gamma;
+        Scalar x = 0.0;
+        if (eta_tilde > 0.0 && params.risk_aversion > 0.0) {
+            x = 0.5 * params.risk_aversion * params.sigma * params.sigma / eta_tilde;
+        }
+        kappa_[k] = std::log1p(x + std::sqrt(x * (x + 2.0)));
+        r_[k] = std::exp(-kappa_[k]);
+
+        first_[k].resize(kMaxCachedHorizon + 1);
+        for (int h = 0; h <= kMaxCachedHorizon; ++h) first_[k][h] = firstFractionClosedForm(kappa_[k], h);
+
+        rebuildCache(k);
+    }
+
+    const AlmgrenChrissParams& AlmgrenChrissSolver::getParameters(MarketRegime regime) const {
+        return params_[index(regime)];
+    }
+
+    Scalar AlmgrenChrissSolver::kappa(MarketRegime regime) const {
+        return kappa_[index(regime)];
+    }
+
+    Scalar AlmgrenChrissSolver::firstFractionClosedForm(Scalar kappa, int horizon) {
+        if (horizon <= 1) return 1.0;
+        if (kappa == 0.0) return 1.0 / horizon;
+        // expm1 keeps (1 - r) / (1 - r^{2N}) accurate when kappa is small
+        return (1.0 + std::exp(-(2.0 * horizon - 1.0) * kappa)) * std::expm1(-kappa) / std::expm1(-2.0 * horizon * kappa);
+    }
+
+    Scalar AlmgrenChrissSolver::firstFraction(MarketRegime regime, int horizon) const {
+        if (horizon <= 1) return 1.0;
+        const int k = index(regime);
+        if (horizon <= kMaxCachedHorizon) return first_[k][horizon];
+        return firstFractionClosedForm(kappa_[k], horizon);
+    }
+
+    void AlmgrenChrissSolver::precompute(const std::vector<int>& horizons) {
+        for (int h : horizons) {
+            if (h < 1 || h > kMaxCachedHorizon) continue;
+            if (std::find(cached_horizons_.begin(), cached_horizons_.end(), h) != cached_horizons_.end()) continue;
+            cached_horizons_.push_back(h);
+        }
+        for (int k = 0; k < 3; ++k) rebuildCache(k);
+    }
+
+    void AlmgrenChrissSolver::rebuildCache(int k) {
+        std::fill(offset_[k].begin(), offset_[k].end(), -1);
+        size_t total = 0;
+        for (int h : cached_horizons_) total += h;
+        cache_[k].resize(total);
+
+        int offset = 0;
+        for (int h : cached_horizons_) {
+            fractions(k, h, cache_[k].data() + offset);
+            offset_[k][h] = offset;
+            offset += h;
+        }
+    }
+
+    void AlmgrenChrissSolver::fractions(int k, int horizon, Scalar* out) const {
+        const Scalar r = r_[k];
+
+        // n_j ~ r^{j-1} + r^{2N-j}: forward powers, then backward powers added in
+        Scalar p = 1.0;
+        for (int j = 0; j < horizon; ++j) {
+            out[j] = p;
+            p *= r;
+        }
+        // p = r^N here, which is the second term of the last period
+        for (int j = horizon - 1; j >= 0; --j) {
+            out[j] += p;
+            p *= r;
+        }
+
+        Scalar sum = 0.0;
+        for (int j = 0; j < horizon; ++j) sum += out[j];
+        Scalar inv = 1.0 / sum;
+        for (int j = 0; j < horizon; ++j) out[j] *= inv;
+    }
+
+    bool AlmgrenChrissSolver::schedule(MarketRegime regime, Scalar order_size, int horizon, Scalar* out) const {
+        if (horizon < 1) return false;
+        const int k = index(regime);
+
+        if (horizon <= kMaxCachedHorizon && offset_[k][horizon] >= 0) {
+            const Scalar* frac = cache_[k].data() + offset_[k][horizon];
+            for (int j = 0; j < horizon; ++j) out[j] = order_size * frac[j];
+            return true;
+        }
+
+        fractions(k, horizon, out);
+        for (int j = 0; j < horizon; ++j) out[j] *= order_size;
+        return true;
+    }
+
+    Vector AlmgrenChrissSolver::schedule(MarketRegime regime, Scalar order_size, int horizon) const {
+        Vector out(std::max(horizon, 0));
+        schedule(regime, order_size, horizon, out.data());
+        return out;
+    }
+
+    bool AlmgrenChrissSolver::holdings(MarketRegime regime, Scalar order_size, int horizon, Scalar* out) const {
+        if (!schedule(regime, order_size, horizon, out + 1)) return false;
+
+        // Remaining after each period; the last entry is exactly zero
+        out[0] = order_size;
+        for (int j = 1; j <= horizon; ++j) out[j] = out[j - 1] - out[j];
+        out[horizon] = 0.0;
+        return true;
+    }
+
+    ScheduleCost AlmgrenChrissSolver::evaluate(MarketRegime regime, const Scalar* trades, int horizon) const {
+        const AlmgrenChrissParams& p = params_[index(regime)];
+        ScheduleCost cost{0.0, 0.0};
+        if (horizon < 1) return cost;
+
+        Scalar total = 0.0;
+        Scalar sum_sq_trades = 0.0;
+        for (int j = 0; j < horizon; ++j) {
+            total += trades[j];
+            sum_sq_trades += trades[j] * trades[j];
+        }
+
+        // Holdings carried over periods 1 .. N-1
+        Scalar remaining = total;
+        Scalar sum_sq_hold = 0.0;
+        for (int j = 0; j < horizon - 1; ++j) {
+            remaining -= trades[j];
+            sum_sq_hold += remaining * remaining;
+        }
+
+        cost.expected = 0.5 * p.gamma * total * total + (p.eta - 0.5 * p.gamma) * sum_sq_trades;
+        cost.variance = p.sigma * p.sigma * sum_sq_hold;
+        return cost;
+    }
+
+}
@@ -0,0 +1,37 @@
+#include "../include/adaptive_exec/CrossSectionalVolatility.hpp"
+
+namespace AdaptiveExec {
+
+    void VolatilityTable::resize(size_t n_symbols) {
+        rv.resize(n_symbols);
+        bv.resize(n_symbols);
+        medrv.resize(n_symbols);
+        tsrv.resize(n_symbols);
+        rj.resize(n_symbols);
+    }
+
+    void CrossSectionalVolatility::compute(const ReturnPanel& panel, VolatilityTable& table,
+                                           int K, Scalar annualization_factor, ThreadPool& pool) {
+        table.resize(panel.n_symbols);
+
+        // Small grain: per-symbol cost varies by orders of magnitude, stealing balances it
+        const size_t grain = 4;
+
+        pool.parallelFor(panel.n_symbols, grain, [&](size_t begin, size_t end, size_t) {
+            for (size_t s = begin; s < end; ++s) {
+                size_t first = panel.offsets[s];
+                size_t len = panel.offsets[s + 1] - first;
+
+                VolatilityFeatures f = VolatilityEstimators::computeFeatures(
+                    panel.returns + first, len, K, annualization_factor);
+
+                table.rv[s] = f.rv;
+                table.bv[s] = f.bv;
+                table.medrv[s] = f.medrv;
+                table.tsrv[s] = f.tsrv;
+                table.rj[s] = f.rj;
+            }
+        });
+    }
+
+}
@@ -1,4 +1,6 @@
 #include "../include/adaptive_exec/ExecutionEngine.hpp"
+#include "../include/adaptive_exec/AlmgrenChrissSolver.hpp"
+#include "../include/adaptive_exec/utils/KillSwitch.hpp"
 #include <cmath>
 #include <numeric>
 #include <iostream>
@@ -65,12 +67,22 @@ namespace AdaptiveExec {
         return schedule;
     }
 
-    bool ExecutionEngine::checkCircuitBreaker(double current_intensity, double limit) {
+    bool ExecutionEngine::getOptimalSchedule(MarketRegime state, Scalar order_size, int time_horizon, Scalar* out) {
+        // Built once (thread-safe static init), read-only afterwards
+        static const AlmgrenChrissSolver solver;
+        return solver.schedule(state, order_size, time_horizon, out);
+    }
+
+    bool ExecutionEngine::checkCircuitBreaker(double current_intensity, double limit, bool trip_kill_switch) {
         if (current_intensity > limit) {
-            // In a real system, this would trigger an atomic shutdown flag
+            if (trip_kill_switch) KillSwitch::global().trip(TripReason::HawkesIntensity);
             return true;
         }
         return false;
     }
 
+    bool ExecutionEngine::isHalted() {
+        return KillSwitch::global().isTripped();
+    }
+
 }
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "../include/adaptive_exec/ExecutionScheduler.hpp"
+#include "../include/adaptive_exec/utils/KillSwitch.hpp"
+#include <algorithm>
+
+namespace AdaptiveExec {
+
+    ExecutionScheduler::ExecutionScheduler(uint64_t start_tick, MarketRegime regime, const AlmgrenChrissSolver& solver)
+        : solver_(solver), regime_(regime), now_(start_tick), live_(0) {
+        heads_.fill(kNone);
+        level_count_.fill(0);
+    }
+
+    uint64_t ExecutionScheduler::submit(Scalar quantity, int periods, uint64_t interval_ticks, uint64_t first_release) {
+        if (periods < 1) return 0;
+
+        int32_t p;
+        if (!free_.empty()) {
+            p = free_.back();
+            free_.pop_back();
+        } else {
+            p = static_cast<int32_t>(parents_.size());
+            parents_.push_back(Parent{0, kNone, kNone, kNone, 0, 0.0, 0, 0});
+        }
+
+        Parent& order = parents_[p];
+        order.expiry = std::max(first_release, now_ + 1);
+        order.remaining = quantity;
+        order.periods_left = periods;
+        order.interval = std::max<uint64_t>(interval_ticks, 1);
+        insert(p);
+        ++live_;
+        return makeId(static_cast<uint32_t>(p), order.generation);
+    }
+
+    int32_t ExecutionScheduler::find(uint64_t parent_id) const {
+        uint64_t low = parent_id & 0xFFFFFFFFULL;
+        if (low == 0 || low > parents_.size()) return kNone;
+        int32_t p = static_cast<int32_t>(low - 1);
+        const Parent& order = parents_[p];
+        if (order.slot == kNone || order.generation != static_cast<uint32_t>(parent_id >> 32)) return kNone;
+        return p;
+    }
+
+    bool ExecutionScheduler::cancel(uint64_t parent_id) {
+        int32_t p = find(parent_id);
+        if (p == kNone) return false;
+        unlink(p);
+        release(p);
+        return true;
+    }
+
+    Scalar ExecutionScheduler::remaining(uint64_t parent_id) const {
+        int32_t p = find(parent_id);
+        return p == kNone ? 0.0 : parents_[p].remaining;
+    }
+
+    void ExecutionScheduler::insert(int32_t p) {
+        Parent& order = parents_[p];
+
+        // Level by distance to expiry; beyond the top level the timer waits in the farthest
+        // top-level slot and is re-inserted whenever that slot cascades
+        uint64_t delta = order.expiry - now_;
+        uint64_t expiry = order.expiry;
+        int level = 0;
+        while (level < kLevels - 1 && delta >= (uint64_t(1) << (kSlotBits * (level + 1)))) ++level;
+        const uint64_t span = uint64_t(1) << (kSlotBits * kLevels);
+        if (delta >= span) expiry = now_ + span - 1;
+
+        int32_t slot = static_cast<int32_t>(level * kSlots + ((expiry >> (kSlotBits * level)) & kSlotMask));
+        order.slot = slot;
+        order.prev = kNone;
+        order.next = heads_[slot];
+        if (order.next != kNone) parents_[order.next].prev = p;
+        heads_[slot] = p;
+        ++level_count_[level];
+    }
+
+    void ExecutionScheduler::unlink(int32_t p) {
+        Parent& order = parents_[p];
+        if (order.prev != kNone) parents_[order.prev].next = order.next;
+        else heads_[order.slot] = order.next;
+        if (order.next != kNone) parents_[order.next].prev = order.prev;
+        --level_count_[order.slot / kSlots];
+    }
+
+    void ExecutionScheduler::release(int32_t p) {
+        Parent& order = parents_[p];
+        order.slot = kNone;
+        ++order.generation;
+        free_.push_back(p);
+        --live_;
+    }
+
+    void ExecutionScheduler::cascade(int level) {
+        int32_t slot = static_cast<int32_t>(level * kSlots + ((now_ >> (kSlotBits * level)) & kSlotMask));
+        int32_t p = heads_[slot];
+        heads_[slot] = kNone;
+        while (p != kNone) {
+            int32_t next = parents_[p].next;
+            --level_count_[level];
+            insert(p);
+            p = next;
+        }
+    }
+
+    void ExecutionScheduler::fire(uint64_t tick, std::vector<ChildOrder>& out) {
+        int32_t slot = static_cast<int32_t>(tick & kSlotMask);
+        int32_t p = heads_[slot];
+        heads_[slot] = kNone;
+
+        // Trading halted: hold every due slice for one interval, nothing is released
+        const bool halted = KillSwitch::global().isTripped();
+
+        while (p != kNone) {
+            Parent& order = parents_[p];
+            int32_t next = order.next;
+            --level_count_[0];
+
+            if (halted) {
+                order.expiry = tick + order.interval;
+                insert(p);
+                p = next;
+                continue;
+            }
+
+            // Lazy sizing under the current regime (exactly the rest on the last slice)
+            Scalar qty = order.periods_left == 1
+                ? order.remaining
+                : order.remaining * solver_.firstFraction(regime_, order.periods_left);
+            order.remaining -= qty;
+            --order.periods_left;
+            out.push_back(ChildOrder{makeId(static_cast<uint32_t>(p), order.generation), tick, qty,
+                                     order.periods_left, regime_});
+
+            if (order.periods_left > 0) {
+                order.expiry = tick + order.interval;
+                insert(p);
+            } else {
+                release(p);
+            }
+            p = next;
+        }
+    }
+
+    size_t ExecutionScheduler::advance(uint64_t to_tick, std::vector<ChildOrder>& out) {
+        const size_t before = out.size();
+
+        while (now_ < to_tick) {
+            // Nothing left anywhere: jump straight to the target
+            bool empty = true;
+            for (size_t c : level_count_) empty = empty && c == 0;
+            if (empty) {
+                now_ = to_tick;
+                break;
+            }
+
+            // Levels below l empty: nothing can fire or cascade before the next multiple of
+            // 256^l, so skip to the last tick before it
+            int lowest = 0;
+            while (level_count_[lowest] == 0) ++lowest;
+            if (lowest > 0) {
+                uint64_t block_end = now_ | ((uint64_t(1) << (kSlotBits * lowest)) - 1);
+                if (block_end >= to_tick) {
+                    now_ = to_tick;
+                    break;
+                }
+                now_ = block_end;
+            }
+
+            ++now_;
+
+            // Entering a new block: pull the matching slot of each higher level down
+            for (int level = 1; level < kLevels; ++level) {
+                if ((now_ & ((uint64_t(1) << (kSlotBits * level)) - 1)) != 0) break;
+                cascade(level);
+            }
+            if (level_count_[0] > 0) fire(now_, out);
+        }
+
+        return out.size() - before;
+    }
+
+}
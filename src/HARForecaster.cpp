@@ -0,0 +1,70 @@
+#include "../include/adaptive_exec/HARForecaster.hpp"
+
+namespace AdaptiveExec {
+
+    HARForecaster::HARForecaster(const Vector& coefficients) {
+        setCoefficients(coefficients);
+        reset();
+    }
+
+    HARForecaster::HARForecaster(const HARModel& model) {
+        setCoefficients(model.getCoefficients());
+        is_fitted_ = model.isFitted();
+        reset();
+    }
+
+    void HARForecaster::setCoefficients(const Vector& coefficients) {
+        coefficients_.setZero();
+        is_fitted_ = coefficients.size() == 5;
+        if (is_fitted_) coefficients_ = coefficients;
+    }
+
+    void HARForecaster::reset() {
+        rv_ring_.fill(0.0);
+        n_ = 0;
+        sum_w_ = 0.0;
+        sum_m_ = 0.0;
+        rj_last_ = 0.0;
+    }
+
+    Scalar HARForecaster::update(Scalar rv, Scalar rj) {
+        const size_t t = n_;
+
+        // Yesterday becomes lag 1; lag 5 drops out of the week, lag 22 out of the month
+        if (t >= 1) {
+            Scalar prev = rv_ring_[(t - 1) % kHistory];
+            sum_w_ += prev;
+            sum_m_ += prev;
+            if (t >= 6) sum_w_ -= rv_ring_[(t - 6) % kHistory];
+            if (t >= 23) sum_m_ -= rv_ring_[(t - 23) % kHistory];
+        }
+
+        rv_ring_[t % kHistory] = rv;
+        rj_last_ = rj;
+        ++n_;
+
+        // Re-anchor every 22 days, summing lags in the same order as HARModel::predict
+        if (n_ % 22 == 0) {
+            sum_w_ = 0.0;
+            for (size_t k = 1; k <= 5 && k <= t; ++k) sum_w_ += rv_ring_[(t - k) % kHistory];
+            sum_m_ = 0.0;
+            for (size_t k = 1; k <= 22 && k <= t; ++k) sum_m_ += rv_ring_[(t - k) % kHistory];
+        }
+
+        return forecast();
+    }
+
+    bool HARForecaster::features(Eigen::Matrix<Scalar, 5, 1>& x) const {
+        if (!isReady()) return false;
+        x << 1.0, rv_ring_[(n_ - 1) % kHistory], sum_w_ / 5.0, sum_m_ / 22.0, rj_last_;
+        return true;
+    }
+
+    Scalar HARForecaster::forecast() const {
+        Eigen::Matrix<Scalar, 5, 1> x;
+        if (!is_fitted_ || !features(x)) return 0.0;
+
+        return x.dot(coefficients_);
+    }
+
+}
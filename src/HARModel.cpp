@@ -1,6 +1,7 @@
 #include "../include/adaptive_exec/HARModel.hpp"
 #include <iostream>
 #include <numeric>
+#include <algorithm>
 
 namespace AdaptiveExec {
 
@@ -8,7 +9,7 @@ namespace AdaptiveExec {
         coefficients_ = Vector::Zero(5);
     }
 
-    std::pair<Matrix, Vector> HARModel::createFeatures(const Vector& rv, const Vector& rj) {
+    std::pair<Matrix, Vector> HARModel::createFeatures(const VectorView& rv, const VectorView& rj) {
         // Python:
         // rv_d = rv[22:] (t-1)
         // rv_w = mean(rv[i-5:i])
@@ -76,7 +77,7 @@ namespace AdaptiveExec {
         return {X, y};
     }
 
-    double HARModel::fit(const Vector& rv, const Vector& rj) {
+    double HARModel::fit(const VectorView& rv, const VectorView& rj) {
         auto data = createFeatures(rv, rj);
         const Matrix& X = data.first;
         const Vector& y = data.second;
@@ -99,11 +100,11 @@ namespace AdaptiveExec {
         return 1.0 - (ss_res / ss_tot);
     }
 
-    Scalar HARModel::predict(const Vector& rv, const Vector& rj) {
+    Scalar HARModel::predict(const VectorView& rv, const VectorView& rj) {
         if (!is_fitted_) return 0.0;
         
         long n = rv.size();
-        if (n < 22) return 0.0; // Not enough history
+        if (n < 23) return 0.0; // Not enough history (monthly lags reach back to curr - 22)
 
         // Prepare feature vector for the *next* day
         // Uses the *last* available data points
@@ -147,12 +148,80 @@ namespace AdaptiveExec {
         
         Scalar val_j = rj[curr];
 
-        Vector x(5);
+        // Fixed-size feature vector: no heap allocation on the prediction path
+        Eigen::Matrix<Scalar, 5, 1> x;
         x << 1.0, val_d, val_w, val_m, val_j;
 
         return x.dot(coefficients_);
     }
     
+    Matrix HARModel::forecastBatch(const HARPanel& panel, const Matrix& coefficients,
+                                   const std::vector<int>& horizons) {
+        const long S = static_cast<long>(panel.n_symbols);
+        Matrix forecasts = Matrix::Zero(S, horizons.size());
+        if (S == 0 || horizons.empty() || coefficients.rows() != S || coefficients.cols() != 5) {
+            return forecasts;
+        }
+
+        int max_h = *std::max_element(horizons.begin(), horizons.end());
+        if (max_h < 1) return forecasts;
+
+        // Symbol-major path of daily RVs: columns 0..22 are the last 23 observed days
+        // (column 22 = today), column 22 + h is the h-day-ahead forecast.
+        // Each column is contiguous across symbols, so every step is a handful of axpys.
+        const long today = 22;
+        Matrix path = Matrix::Zero(S, today + 1 + max_h);
+        Vector rj_today = Vector::Zero(S);
+        Vector rj_future = Vector::Zero(S);
+        std::vector<bool> has_history(S, false);
+
+        for (long s = 0; s < S; ++s) {
+            size_t first = panel.offsets[s];
+            size_t len = panel.offsets[s + 1] - first;
+            if (len < 23) continue;
+            has_history[s] = true;
+
+            const Scalar* rv = panel.rv + first + (len - 23);
+            for (long c = 0; c <= today; ++c) path(s, c) = rv[c];
+
+            const Scalar* rj = panel.rj + first + (len - 22);
+            Scalar sum_rj = 0.0;
+            for (int k = 0; k < 22; ++k) sum_rj += rj[k];
+            rj_today(s) = rj[21];
+            rj_future(s) = sum_rj / 22.0;
+        }
+
+        Vector sum_w(S), sum_m(S), f(S);
+        for (int h = 1; h <= max_h; ++h) {
+            const long curr = today + h - 1;
+
+            // Same lags as predict: weekly = curr-1..curr-5, monthly = curr-1..curr-22
+            sum_w.setZero();
+            for (int k = 1; k <= 5; ++k) sum_w += path.col(curr - k);
+            sum_m.setZero();
+            for (int k = 1; k <= 22; ++k) sum_m += path.col(curr - k);
+
+            const Vector& jumps = (h == 1) ? rj_today : rj_future;
+
+            f = coefficients.col(0);
+            f.array() += coefficients.col(1).array() * path.col(curr).array();
+            f.array() += coefficients.col(2).array() * (sum_w.array() / 5.0);
+            f.array() += coefficients.col(3).array() * (sum_m.array() / 22.0);
+            f.array() += coefficients.col(4).array() * jumps.array();
+            path.col(curr + 1) = f;
+        }
+
+        for (size_t k = 0; k < horizons.size(); ++k) {
+            if (horizons[k] < 1) continue;
+            forecasts.col(k) = path.col(today + horizons[k]);
+        }
+        for (long s = 0; s < S; ++s) {
+            if (!has_history[s]) forecasts.row(s).setZero();
+        }
+
+        return forecasts;
+    }
+
     Vector HARModel::getCoefficients() const {
         return coefficients_;
     }
@@ -0,0 +1,145 @@
+#include "../include/adaptive_exec/HAROnlineFitter.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace AdaptiveExec {
+
+    HAROnlineFitter::HAROnlineFitter(Scalar forgetting, size_t window)
+        : lambda_(window > 0 ? 1.0 : std::min(1.0, std::max(1e-3, forgetting))),
+          window_(window > 0 ? std::max<size_t>(window, 5) : 0),
+          features_(Vector::Zero(5)) {
+        win_x_.resize(window_);
+        win_y_.resize(window_);
+        reset();
+    }
+
+    void HAROnlineFitter::reset() {
+        features_.reset();
+        x_prev_.setZero();
+        has_prev_ = false;
+
+        xtx_.setZero();
+        xty_.setZero();
+        yty_ = 0.0;
+        sum_y_ = 0.0;
+        weight_ = 0.0;
+
+        theta_.setZero();
+        P_.setZero();
+        is_fitted_ = false;
+        n_samples_ = 0;
+        total_samples_ = 0;
+        since_anchor_ = 0;
+    }
+
+    bool HAROnlineFitter::update(Scalar rv, Scalar rj) {
+        if (has_prev_) {
+            // Sample: yesterday's regressors -> today's RV
+            if (window_ > 0) {
+                size_t slot = total_samples_ % window_;
+                addSample(x_prev_, rv);
+                if (total_samples_ >= window_) removeSample(win_x_[slot], win_y_[slot]);
+                win_x_[slot] = x_prev_;
+                win_y_[slot] = rv;
+            } else {
+                addSample(x_prev_, rv);
+            }
+            ++total_samples_;
+            n_samples_ = (window_ > 0) ? std::min(total_samples_, window_) : total_samples_;
+
+            if (!is_fitted_ || ++since_anchor_ >= kReanchorEvery) reanchor();
+        }
+
+        features_.update(rv, rj);
+        bool was_sample = has_prev_;
+        has_prev_ = features_.features(x_prev_);
+        return was_sample && is_fitted_;
+    }
+
+    Scalar HAROnlineFitter::fit(const VectorView& rv, const VectorView& rj) {
+        long n = std::min(rv.size(), rj.size());
+        for (long t = 0; t < n; ++t) update(rv[t], rj[t]);
+        return rSquared();
+    }
+
+    void HAROnlineFitter::addSample(const Vec5& x, Scalar y) {
+        xtx_ = lambda_ * xtx_ + x * x.transpose();
+        xty_ = lambda_ * xty_ + x * y;
+        yty_ = lambda_ * yty_ + y * y;
+        sum_y_ = lambda_ * sum_y_ + y;
+        weight_ = lambda_ * weight_ + 1.0;
+
+        if (!is_fitted_) return;
+
+        // Rank-one RLS update with forgetting
+        Vec5 Px = P_ * x;
+        Scalar denom = lambda_ + x.dot(Px);
+        Vec5 k = Px / denom;
+        theta_ += k * (y - x.dot(theta_));
+        P_ = (P_ - k * Px.transpose()) / lambda_;
+        P_ = 0.5 * (P_ + P_.transpose());
+    }
+
+    void HAROnlineFitter::removeSample(const Vec5& x, Scalar y) {
+        xtx_ -= x * x.transpose();
+        xty_ -= x * y;
+        yty_ -= y * y;
+        sum_y_ -= y;
+        weight_ -= 1.0;
+
+        if (!is_fitted_) return;
+
+        // Rank-one downdate: (S - x x^T)^-1 = P + P x x^T P / (1 - x^T P x)
+        Vec5 Px = P_ * x;
+        Scalar denom = 1.0 - x.dot(Px);
+        if (denom <= 1e-12) {
+            // Removing this sample (nearly) loses rank; rebuild from the sums
+            is_fitted_ = false;
+            return;
+        }
+        Vec5 k = Px / denom;
+        theta_ -= k * (y - x.dot(theta_));
+        P_ += k * Px.transpose();
+        P_ = 0.5 * (P_ + P_.transpose());
+    }
+
+    bool HAROnlineFitter::reanchor() {
+        since_anchor_ = 0;
+        if (n_samples_ < 5) return false;
+
+        Eigen::LLT<Mat5> llt(xtx_);
+        if (llt.info() != Eigen::Success) {
+            is_fitted_ = false;
+            return false;
+        }
+        Mat5 P = llt.solve(Mat5::Identity());
+        Vec5 theta = llt.solve(xty_);
+        if (!P.allFinite() || !theta.allFinite()) {
+            is_fitted_ = false;
+            return false;
+        }
+
+        P_ = P;
+        theta_ = theta;
+        is_fitted_ = true;
+        return true;
+    }
+
+    Scalar HAROnlineFitter::forecast() const {
+        Vec5 x;
+        if (!is_fitted_ || !features_.features(x)) return 0.0;
+        return x.dot(theta_);
+    }
+
+    Scalar HAROnlineFitter::rSquared() const {
+        if (!is_fitted_ || weight_ <= 0.0) return 0.0;
+
+        // Residual and total sums of squares from the sufficient statistics
+        Scalar ss_res = yty_ - 2.0 * theta_.dot(xty_) + theta_.dot(xtx_ * theta_);
+        Scalar ss_tot = yty_ - sum_y_ * sum_y_ / weight_;
+        if (ss_tot <= 0.0) return 0.0;
+
+        return 1.0 - ss_res / ss_tot;
+    }
+
+}
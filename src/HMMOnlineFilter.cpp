@@ -0,0 +1,107 @@
+#include "../include/adaptive_exec/HMMOnlineFilter.hpp"
+#include <cmath>
+#include <algorithm>
+
+namespace AdaptiveExec {
+
+    HMMOnlineFilter::HMMOnlineFilter(const HMMRegimeDetector& model, int smoothing_lag)
+        : n_states_(model.n_states_), n_features_(model.n_features_),
+          lag_(std::max(0, smoothing_lag)),
+          start_prob_(model.start_prob_), trans_mat_(model.trans_mat_), means_(model.means_),
+          precision_mats_(model.precision_mats_), log_dets_(model.log_dets_),
+          log_norm_const_(model.n_features_ * std::log(2 * M_PI)) {
+        alpha_.resize(n_states_);
+        diff_.resize(n_features_);
+        tmp_.resize(n_features_);
+        emit_.resize(n_states_);
+        pred_.resize(n_states_);
+
+        alpha_hist_.resize(n_states_, lag_ + 1);
+        emit_hist_.resize(n_states_, lag_ + 1);
+        beta_.resize(n_states_);
+        beta_tmp_.resize(n_states_);
+        smoothed_.resize(n_states_);
+
+        reset();
+    }
+
+    void HMMOnlineFilter::reset() {
+        n_obs_ = 0;
+        log_likelihood_ = 0.0;
+        alpha_ = start_prob_;
+        smoothed_.setZero();
+    }
+
+    const Vector& HMMOnlineFilter::update(const RowVectorView& x) {
+        // Log emission per state with precomputed precision matrices, into fixed buffers
+        for (int i = 0; i < n_states_; ++i) {
+            diff_ = x.transpose() - means_.row(i).transpose();
+            tmp_.noalias() = precision_mats_[i] * diff_;
+            emit_(i) = -0.5 * (log_norm_const_ + log_dets_(i) + diff_.dot(tmp_));
+        }
+
+        // Rescale by the max log emission to avoid underflow
+        Scalar max_log = emit_.maxCoeff();
+        emit_ = (emit_.array() - max_log).exp().matrix();
+
+        // Predict (skip on the first bar: alpha_ holds the start distribution)
+        if (n_obs_ == 0) {
+            pred_ = alpha_;
+        } else {
+            pred_.noalias() = trans_mat_.transpose() * alpha_;
+        }
+
+        alpha_ = pred_.cwiseProduct(emit_);
+        Scalar norm = alpha_.sum();
+        if (norm > 0) {
+            alpha_ /= norm;
+            log_likelihood_ += std::log(norm) + max_log;
+        } else {
+            // Observation impossible under every state: fall back to the prediction
+            alpha_ = pred_;
+        }
+
+        if (lag_ > 0) {
+            long slot = n_obs_ % (lag_ + 1);
+            alpha_hist_.col(slot) = alpha_;
+            emit_hist_.col(slot) = emit_;
+        }
+
+        ++n_obs_;
+
+        if (hasSmoothed()) smooth();
+
+        return alpha_;
+    }
+
+    void HMMOnlineFilter::smooth() {
+        // Backward pass over bars t, t-1, ..., t-lag+1 to reach bar t-lag
+        const long t = n_obs_ - 1;
+        beta_.setOnes();
+        for (long k = t; k > t - lag_; --k) {
+            long slot = k % (lag_ + 1);
+            beta_tmp_ = emit_hist_.col(slot).cwiseProduct(beta_);
+            beta_.noalias() = trans_mat_ * beta_tmp_;
+            Scalar norm = beta_.sum();
+            if (norm > 0) beta_ /= norm;
+        }
+
+        long target = (t - lag_) % (lag_ + 1);
+        smoothed_ = alpha_hist_.col(target).cwiseProduct(beta_);
+        Scalar norm = smoothed_.sum();
+        if (norm > 0) smoothed_ /= norm;
+    }
+
+    int HMMOnlineFilter::currentState() const {
+        int best = 0;
+        alpha_.maxCoeff(&best);
+        return best;
+    }
+
+    int HMMOnlineFilter::smoothedState() const {
+        int best = 0;
+        smoothed_.maxCoeff(&best);
+        return best;
+    }
+
+}
@@ -1,10 +1,110 @@
 #include "../include/adaptive_exec/HMMRegimeDetector.hpp"
 #include <cmath>
-#include <iostream>
+#include <cstdint>
 #include <limits>
+#include <numeric>
+#include <algorithm>
 
 namespace AdaptiveExec {
 
+    namespace {
+
+        // Per-sequence sufficient statistics for one Baum-Welch iteration
+        struct SufficientStats {
+            Vector start;               // gamma_0
+            Matrix trans;               // sum_t xi_t(i, j)
+            Vector occupancy;           // sum_t gamma_t(i)
+            Matrix weighted_sum;        // sum_t gamma_t(i) * x_t   (States x Features)
+            std::vector<Matrix> scatter; // sum_t gamma_t(i) * x_t x_t^T
+            Scalar log_likelihood = 0.0;
+        };
+
+        // Scaled forward-backward (Rabiner 1989) on a precomputed log-emission matrix.
+        // obs must already be shifted by the training centre.
+        void accumulateStats(const Matrix& obs, const Matrix& log_emit, const Vector& start_prob,
+                             const Matrix& trans_mat, SufficientStats& st) {
+            const long T = obs.rows();
+            const long N = log_emit.cols();
+            const long D = obs.cols();
+
+            st.start = Vector::Zero(N);
+            st.trans = Matrix::Zero(N, N);
+            st.occupancy = Vector::Zero(N);
+            st.weighted_sum = Matrix::Zero(N, D);
+            st.scatter.assign(N, Matrix::Zero(D, D));
+            st.log_likelihood = 0.0;
+            if (T == 0) return;
+
+            // Emission likelihoods rescaled per row to avoid underflow: B(t, i) = exp(logB - m_t)
+            Vector row_max = log_emit.rowwise().maxCoeff();
+            Matrix B = (log_emit.colwise() - row_max).array().exp().matrix();
+
+            Matrix alpha(T, N);
+            Vector scale(T);
+
+            alpha.row(0) = start_prob.transpose().cwiseProduct(B.row(0));
+            scale(0) = alpha.row(0).sum();
+            alpha.row(0) /= scale(0);
+            for (long t = 1; t < T; ++t) {
+                alpha.row(t) = (alpha.row(t - 1) * trans_mat).cwiseProduct(B.row(t));
+                scale(t) = alpha.row(t).sum();
+                alpha.row(t) /= scale(t);
+            }
+            st.log_likelihood = scale.array().log().sum() + row_max.sum();
+
+            Matrix beta(T, N);
+            beta.row(T - 1).setOnes();
+            for (long t = T - 2; t >= 0; --t) {
+                RowVector weighted = B.row(t + 1).cwiseProduct(beta.row(t + 1));
+                beta.row(t) = (trans_mat * weighted.transpose()).transpose() / scale(t + 1);
+
+                // xi_t(i, j) = alpha_t(i) A(i, j) B_{t+1}(j) beta_{t+1}(j) / c_{t+1}
+                st.trans.noalias() += (alpha.row(t).transpose() * weighted).cwiseProduct(trans_mat) / scale(t + 1);
+            }
+
+            Matrix gamma = alpha.cwiseProduct(beta);
+            Vector gamma_norm = gamma.rowwise().sum();
+            gamma.array().colwise() /= gamma_norm.array();
+
+            st.start = gamma.row(0).transpose();
+            st.occupancy = gamma.colwise().sum().transpose();
+            st.weighted_sum.noalias() = gamma.transpose() * obs;
+            for (long i = 0; i < N; ++i) {
+                Matrix weighted_obs = obs.array().colwise() * gamma.col(i).array();
+                st.scatter[i].noalias() = weighted_obs.transpose() * obs;
+            }
+        }
+
+        // Calls fn with a value of the narrowest back-pointer type that can index n_states
+        // states: one byte up to 256 states (the common case), then two, then four
+        template <typename Fn>
+        void withBackPointerType(int n_states, Fn&& fn) {
+            if (n_states <= 256) fn(uint8_t{});
+            else if (n_states <= 65536) fn(uint16_t{});
+            else fn(int32_t{});
+        }
+
+        // Cholesky factor of a covariance, adding a growing ridge to the diagonal until the
+        // factorization succeeds (singular or slightly indefinite estimates); a covariance
+        // that cannot be repaired (non-finite entries) is replaced by the identity
+        Eigen::LLT<Matrix> regularizedCholesky(const Matrix& cov) {
+            const long D = cov.rows();
+            Matrix sym = 0.5 * (cov + cov.transpose());
+            if (!sym.allFinite()) return Eigen::LLT<Matrix>(Matrix::Identity(D, D));
+            Eigen::LLT<Matrix> llt(sym);
+            if (llt.info() == Eigen::Success) return llt;
+
+            Scalar scale = sym.diagonal().cwiseAbs().mean();
+            Scalar ridge = 1e-10 * std::max(scale, Scalar(1e-12));
+            for (int attempt = 0; attempt < 40; ++attempt, ridge *= 10.0) {
+                llt.compute(sym + ridge * Matrix::Identity(D, D));
+                if (llt.info() == Eigen::Success) return llt;
+            }
+            return Eigen::LLT<Matrix>(Matrix::Identity(D, D));
+        }
+
+    }
+
     HMMRegimeDetector::HMMRegimeDetector(int n_states) 
         : n_states_(n_states), n_features_(0) {}
 
@@ -15,123 +115,553 @@ namespace AdaptiveExec {
         variances_ = variances;
         n_features_ = means.cols();
         
-        // Precompute precision matrices and log determinants
+        // Precompute precision matrices, Cholesky factors and log determinants
         precision_mats_.resize(n_states_);
+        chol_factors_.resize(n_states_);
         log_dets_.resize(n_states_);
+
+        log_trans_.resize(n_states_, n_states_);
+        for (int i = 0; i < n_states_; ++i) {
+            for (int j = 0; j < n_states_; ++j) {
+                log_trans_(i, j) = std::log(trans_mat_(i, j) + 1e-9);
+            }
+        }
+
+        // Compressed transitions when at least half of the entries are structural zeros
+        long nnz = (trans_mat_.array() != 0.0).count();
+        use_sparse_ = 2 * nnz <= static_cast<long>(n_states_) * n_states_;
+        if (use_sparse_) {
+            trans_sparse_ = trans_mat_.sparseView(0.0, 0.0);
+            trans_sparse_.makeCompressed();
+        } else {
+            trans_sparse_.resize(0, 0);
+        }
         
         for (int i = 0; i < n_states_; ++i) {
             // Extract covariance for this state
             Matrix cov = variances_.block(i * n_features_, 0, n_features_, n_features_);
-            
-            // Compute Inverse
-            precision_mats_[i] = cov.inverse();
-            
-            // Compute Log Determinant
-            Scalar det = cov.determinant();
-            if (det <= 0) det = 1e-6; 
-            log_dets_[i] = std::log(det);
+
+            // Cholesky, precision and log determinant all come from the same (regularized)
+            // covariance, so every emission path evaluates the same normalized density
+            Eigen::LLT<Matrix> llt = regularizedCholesky(cov);
+            chol_factors_[i] = llt.matrixL();
+            precision_mats_[i] = llt.solve(Matrix::Identity(n_features_, n_features_));
+            log_dets_[i] = 2.0 * chol_factors_[i].diagonal().array().log().sum();
         }
     }
     
     // Helper for Multi-variate Gaussian Log PDF
-    Scalar HMMRegimeDetector::logEmissionProb(int state, const RowVector& x) {
-        Vector mu = means_.row(state);
+    Scalar HMMRegimeDetector::logEmissionProb(int state, const RowVector& x) const {
         // Use precomputed values
         const Matrix& invCov = precision_mats_[state];
         Scalar logDet = log_dets_[state];
         
-        // Calculate (x - mu)
-        Vector diff = x.transpose() - mu;
-        
-        // Mahalanobis distance term: (x-mu)^T * inv(Cov) * (x-mu)
-        Scalar term1 = diff.transpose() * invCov * diff;
+        // Calculate (x - mu) into per-thread buffers, so the per-state call never touches the heap
+        thread_local Vector diff;
+        thread_local RowVector weighted;
+        diff.resize(n_features_);
+        weighted.resize(n_features_);
+        diff = x.transpose() - means_.row(state).transpose();
+
+        // Mahalanobis distance term: (x-mu)^T * inv(Cov) * (x-mu), same evaluation order as
+        // the single Eigen expression (row-vector product first, then the inner product)
+        weighted.noalias() = diff.transpose() * invCov;
+        Scalar term1 = weighted * diff;
         
         Scalar constTerm = n_features_ * std::log(2 * M_PI);
         
         return -0.5 * (constTerm + logDet + term1);
     }
 
-    std::vector<int> HMMRegimeDetector::predictStates(const Matrix& observations) {
-        long T = observations.rows();
-        if (T == 0) return {};
+    Matrix HMMRegimeDetector::computeLogEmissions(const Matrix& observations) const {
+        const long T = observations.rows();
+        const long D = n_features_;
+        Matrix log_emit(T, n_states_);
 
-        // Viterbi Algorithm
-        Matrix delta(T, n_states_);
-        Matrix psi(T, n_states_); 
-        
-        // Init (t=0)
+        // Row blocks sized to stay in cache while every state is evaluated
+        const long block = 1024;
+        const Scalar const_term = D * std::log(2 * M_PI);
+        Matrix centred_t(D, std::min(T, block));
+
+        for (long start = 0; start < T; start += block) {
+            const long len = std::min(block, T - start);
+            auto obs_block = observations.middleRows(start, len);
+            for (int i = 0; i < n_states_; ++i) {
+                // Y = L^-1 (X - mu)^T  ->  Mahalanobis distance = squared column norms of Y
+                auto Y = centred_t.leftCols(len);
+                Y = (obs_block.rowwise() - means_.row(i)).transpose();
+                chol_factors_[i].triangularView<Eigen::Lower>().solveInPlace(Y);
+                log_emit.block(start, i, len, 1) =
+                    (-0.5 * (const_term + log_dets_(i) + Y.colwise().squaredNorm().array())).transpose();
+            }
+        }
+        return log_emit;
+    }
+
+    Scalar HMMRegimeDetector::forwardBackwardLog(const Matrix& log_emit, Matrix& log_gamma) const {
+        const long T = log_emit.rows();
+        const int N = n_states_;
+        log_gamma.resize(T, N);
+        if (T == 0) return 0.0;
+
+        const Scalar neg_inf = -std::numeric_limits<Scalar>::infinity();
+        Matrix log_alpha(T, N);
+        Matrix log_beta(T, N);
+        Vector shifted(N), mixed(N);
+
+        // log(sum_i exp(v_i) * w_i) evaluated as m + log(sum_i exp(v_i - m) * w_i), m = max v
+        auto maxOrZero = [&](const Vector& v) {
+            Scalar m = v.maxCoeff();
+            return std::isfinite(m) ? m : 0.0;
+        };
+
+        // Forward: log alpha_t(j) = logsumexp_i(log alpha_{t-1}(i) + log A(i, j)) + log e_t(j)
+        log_alpha.row(0) = start_prob_.array().log().transpose() + log_emit.row(0).array();
+        for (long t = 1; t < T; ++t) {
+            Vector prev = log_alpha.row(t - 1).transpose();
+            Scalar m = maxOrZero(prev);
+            shifted = (prev.array() - m).exp().matrix();
+            if (use_sparse_) {
+                mixed.noalias() = trans_sparse_.transpose() * shifted;
+            } else {
+                mixed.noalias() = trans_mat_.transpose() * shifted;
+            }
+            log_alpha.row(t) = (mixed.array().log() + m).transpose() + log_emit.row(t).array();
+        }
+
+        Vector last = log_alpha.row(T - 1).transpose();
+        Scalar m_last = maxOrZero(last);
+        Scalar log_likelihood = m_last + std::log((last.array() - m_last).exp().sum());
+
+        // Backward: log beta_t(i) = logsumexp_j(log A(i, j) + log e_{t+1}(j) + log beta_{t+1}(j))
+        log_beta.row(T - 1).setZero();
+        for (long t = T - 2; t >= 0; --t) {
+            Vector next = (log_emit.row(t + 1) + log_beta.row(t + 1)).transpose();
+            Scalar m = maxOrZero(next);
+            shifted = (next.array() - m).exp().matrix();
+            if (use_sparse_) {
+                mixed.noalias() = trans_sparse_ * shifted;
+            } else {
+                mixed.noalias() = trans_mat_ * shifted;
+            }
+            log_beta.row(t) = (mixed.array().log() + m).transpose();
+        }
+
+        // Normalise each row in log space
+        log_gamma = log_alpha + log_beta;
+        for (long t = 0; t < T; ++t) {
+            Scalar m = log_gamma.row(t).maxCoeff();
+            if (!std::isfinite(m)) {
+                log_gamma.row(t).setConstant(neg_inf);
+                continue;
+            }
+            Scalar lse = m + std::log((log_gamma.row(t).array() - m).exp().sum());
+            log_gamma.row(t).array() -= lse;
+        }
+
+        return log_likelihood;
+    }
+
+    void HMMRegimeDetector::viterbiInit(const RowVector& x, Vector& delta) const {
         Vector log_start = start_prob_.array().log();
         for (int i = 0; i < n_states_; ++i) {
-            delta(0, i) = log_start(i) + logEmissionProb(i, observations.row(0));
+            delta(i) = log_start(i) + logEmissionProb(i, x);
         }
+    }
+
+    template <typename Index>
+    void HMMRegimeDetector::viterbiStep(const RowVector& x, const Vector& prev, Vector& next, Index* psi_row) const {
+        if (use_sparse_) {
+            // Every structurally zero entry scores (prev(i) + log(1e-9)) + log_emit, the same
+            // 1e-9 floor as log_trans_. Sorting those partial sums once per step (score down,
+            // index up) lets each column find its best zero predecessor by walking down the
+            // order past its own non-zeros: O(N log N) for the sort plus O(nnz) for the columns.
+            const Scalar log_floor = std::log(1e-9);
+            const Scalar neg_inf = -std::numeric_limits<Scalar>::infinity();
+            thread_local std::vector<Scalar> floored;
+            thread_local std::vector<int> order;
+            thread_local std::vector<int> group_end; // One past the last position with the same score
+            thread_local std::vector<int> stamp;     // stamp[i] == j: i is a non-zero predecessor of j
+            floored.resize(n_states_);
+            order.resize(n_states_);
+            group_end.resize(n_states_);
+            stamp.assign(n_states_, -1);
+            for (int i = 0; i < n_states_; ++i) {
+                floored[i] = prev(i) + log_floor;
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(), [&](int a, int b) {
+                return floored[a] > floored[b] || (floored[a] == floored[b] && a < b);
+            });
+            group_end[n_states_ - 1] = n_states_;
+            for (int k = n_states_ - 2; k >= 0; --k) {
+                group_end[k] = (floored[order[k]] == floored[order[k + 1]]) ? group_end[k + 1] : k + 1;
+            }
 
-        // Recursion
-        for (int t = 1; t < T; ++t) {
             for (int j = 0; j < n_states_; ++j) {
-                Scalar max_prob = -std::numeric_limits<Scalar>::infinity();
+                Scalar max_prob = neg_inf;
                 int best_prev = 0;
-                
-                Scalar log_emit = logEmissionProb(j, observations.row(t));
 
-                for (int i = 0; i < n_states_; ++i) {
-                    Scalar log_trans = std::log(trans_mat_(i, j) + 1e-9); 
-                    Scalar prob = delta(t-1, i) + log_trans + log_emit;
-                    
+                Scalar log_emit = logEmissionProb(j, x);
+
+                for (SparseMatrix::InnerIterator it(trans_sparse_, j); it; ++it) {
+                    int i = static_cast<int>(it.index());
+                    stamp[i] = j;
+                    Scalar prob = prev(i) + log_trans_(i, j) + log_emit;
                     if (prob > max_prob) {
                         max_prob = prob;
                         best_prev = i;
                     }
                 }
-                
-                delta(t, j) = max_prob;
-                psi(t, j) = (Scalar)best_prev;
+
+                // Best zero predecessor: lowest index among those reaching the top floored score.
+                // Within a run of equal scores the first zero entry has the lowest index, so the
+                // rest of the run is jumped over; a later run only matters if adding log_emit
+                // rounds it onto the same sum. A -inf sum can never win, so the walk stops there.
+                Scalar zero_prob = neg_inf;
+                int zero_prev = n_states_;
+                for (int k = 0; k < n_states_;) {
+                    int i = order[k];
+                    if (stamp[i] == j) {
+                        ++k;
+                        continue;
+                    }
+                    Scalar prob = floored[i] + log_emit;
+                    if (zero_prev == n_states_) {
+                        zero_prob = prob;
+                        zero_prev = i;
+                        if (prob == neg_inf) break;
+                    } else if (prob == zero_prob) {
+                        zero_prev = std::min(zero_prev, i);
+                    } else {
+                        break;
+                    }
+                    k = group_end[k];
+                }
+
+                // Same outcome as the dense scan: higher score wins, ties go to the lower index
+                if (zero_prev < n_states_ &&
+                    (zero_prob > max_prob || (zero_prob == max_prob && zero_prev < best_prev))) {
+                    max_prob = zero_prob;
+                    best_prev = zero_prev;
+                }
+
+                next(j) = max_prob;
+                psi_row[j] = static_cast<Index>(best_prev);
+            }
+            return;
+        }
+
+        for (int j = 0; j < n_states_; ++j) {
+            Scalar max_prob = -std::numeric_limits<Scalar>::infinity();
+            int best_prev = 0;
+
+            Scalar log_emit = logEmissionProb(j, x);
+
+            for (int i = 0; i < n_states_; ++i) {
+                Scalar prob = prev(i) + log_trans_(i, j) + log_emit;
+
+                if (prob > max_prob) {
+                    max_prob = prob;
+                    best_prev = i;
+                }
             }
+
+            next(j) = max_prob;
+            psi_row[j] = static_cast<Index>(best_prev);
+        }
+    }
+
+    template <typename Index>
+    void HMMRegimeDetector::viterbiDecode(const Matrix& observations, int* states, std::vector<Index>& psi) const {
+        const long T = observations.rows();
+
+        // Viterbi Algorithm: compact back-pointers, two delta rows
+        const int N = n_states_;
+        psi.resize(static_cast<size_t>(T) * N);
+        Vector delta(N), next(N);
+        RowVector x(n_features_);
+
+        // Init (t=0)
+        x = observations.row(0);
+        viterbiInit(x, delta);
+
+        // Recursion
+        for (long t = 1; t < T; ++t) {
+            x = observations.row(t);
+            viterbiStep(x, delta, next, &psi[t * N]);
+            delta.swap(next);
         }
 
         // Backtracking
-        std::vector<int> states(T);
         Scalar max_final = -std::numeric_limits<Scalar>::infinity();
         int best_final_state = 0;
-        for (int i = 0; i < n_states_; ++i) {
-            if (delta(T-1, i) > max_final) {
-                max_final = delta(T-1, i);
+        for (int i = 0; i < N; ++i) {
+            if (delta(i) > max_final) {
+                max_final = delta(i);
                 best_final_state = i;
             }
         }
         states[T-1] = best_final_state;
         
-        for (int t = T - 2; t >= 0; --t) {
-            states[t] = (int)psi(t+1, states[t+1]);
+        for (long t = T - 2; t >= 0; --t) {
+            states[t] = psi[(t + 1) * N + states[t + 1]];
         }
-        
+    }
+
+    std::vector<int> HMMRegimeDetector::predictStates(const Matrix& observations) const {
+        long T = observations.rows();
+        if (T == 0) return {};
+
+        std::vector<int> states(T);
+        withBackPointerType(n_states_, [&](auto index) {
+            std::vector<decltype(index)> psi;
+            viterbiDecode(observations, states.data(), psi);
+        });
         return states;
     }
 
-    Matrix HMMRegimeDetector::predictProba(const Matrix& observations) {
+    void HMMRegimeDetector::predictStatesBatch(const std::vector<Matrix>& sequences, std::vector<int>& states,
+                                               ThreadPool& pool) const {
+        std::vector<size_t> offsets(sequences.size() + 1, 0);
+        for (size_t s = 0; s < sequences.size(); ++s) offsets[s + 1] = offsets[s] + sequences[s].rows();
+        states.resize(offsets.back());
+
+        withBackPointerType(n_states_, [&](auto index) {
+            // One back-pointer buffer per worker, grown to its longest sequence
+            std::vector<std::vector<decltype(index)>> psi(pool.size());
+
+            pool.parallelFor(sequences.size(), 1, [&](size_t begin, size_t end, size_t worker) {
+                for (size_t s = begin; s < end; ++s) {
+                    if (sequences[s].rows() == 0) continue;
+                    viterbiDecode(sequences[s], states.data() + offsets[s], psi[worker]);
+                }
+            });
+        });
+    }
+
+    std::vector<int> HMMRegimeDetector::predictStatesCheckpointed(const Matrix& observations, long checkpoint_interval) const {
         long T = observations.rows();
-        Matrix alpha(T, n_states_);
-        
-        for (int i = 0; i < n_states_; ++i) {
-            alpha(0, i) = start_prob_(i) * std::exp(logEmissionProb(i, observations.row(0)));
+        if (T == 0) return {};
+
+        const long K = (checkpoint_interval > 0)
+            ? checkpoint_interval
+            : std::max(1L, static_cast<long>(std::ceil(std::sqrt(static_cast<double>(T)))));
+
+        std::vector<int> states(T);
+        withBackPointerType(n_states_, [&](auto index) {
+            std::vector<decltype(index)> psi;
+            viterbiDecodeCheckpointed(observations, K, states.data(), psi);
+        });
+        return states;
+    }
+
+    template <typename Index>
+    void HMMRegimeDetector::viterbiDecodeCheckpointed(const Matrix& observations, long K, int* states,
+                                                      std::vector<Index>& psi) const {
+        const long T = observations.rows();
+        const int N = n_states_;
+
+        // Segment s replays steps (sK, min((s+1)K, T-1)] from the delta row at t = sK
+        const long n_segments = (T > 1) ? (T - 2) / K + 1 : 0;
+        Matrix checkpoints(std::max(1L, n_segments), N);
+
+        Vector delta(N), next(N);
+        RowVector x(n_features_);
+        psi.resize(static_cast<size_t>(std::min(K, T)) * N);
+
+        // Forward pass: keep one delta row, checkpoint every K steps
+        x = observations.row(0);
+        viterbiInit(x, delta);
+        for (long t = 1; t < T; ++t) {
+            if ((t - 1) % K == 0) checkpoints.row((t - 1) / K) = delta.transpose();
+            x = observations.row(t);
+            viterbiStep(x, delta, next, psi.data());
+            delta.swap(next);
         }
-        
-        for (int t = 1; t < T; ++t) {
-            for (int j = 0; j < n_states_; ++j) {
-                Scalar sum = 0.0;
-                for (int i = 0; i < n_states_; ++i) {
-                    sum += alpha(t-1, i) * trans_mat_(i, j);
-                }
-                alpha(t, j) = sum * std::exp(logEmissionProb(j, observations.row(t)));
+
+        int best_final_state = 0;
+        Scalar max_final = -std::numeric_limits<Scalar>::infinity();
+        for (int i = 0; i < N; ++i) {
+            if (delta(i) > max_final) {
+                max_final = delta(i);
+                best_final_state = i;
             }
-            Scalar row_sum = alpha.row(t).sum();
-            if (row_sum > 0) alpha.row(t) /= row_sum;
         }
-        
-        return alpha;
+        states[T-1] = best_final_state;
+
+        // Backtrack segment by segment, last to first
+        for (long s = n_segments - 1; s >= 0; --s) {
+            const long begin = s * K;
+            const long end = std::min(begin + K, T - 1);
+
+            delta = checkpoints.row(s).transpose();
+            for (long t = begin + 1; t <= end; ++t) {
+                x = observations.row(t);
+                viterbiStep(x, delta, next, &psi[(t - begin - 1) * N]);
+                delta.swap(next);
+            }
+
+            for (long t = end; t > begin; --t) {
+                states[t - 1] = psi[(t - begin - 1) * N + states[t]];
+            }
+        }
+    }
+
+    Matrix HMMRegimeDetector::predictProba(const Matrix& observations) const {
+        Matrix log_gamma;
+        forwardBackwardLog(computeLogEmissions(observations), log_gamma);
+        return log_gamma.array().exp().matrix();
+    }
+
+    void HMMRegimeDetector::predictProbaBatch(const std::vector<Matrix>& sequences, Matrix& proba,
+                                              ThreadPool& pool) const {
+        std::vector<long> offsets(sequences.size() + 1, 0);
+        for (size_t s = 0; s < sequences.size(); ++s) offsets[s + 1] = offsets[s] + sequences[s].rows();
+        proba.resize(offsets.back(), n_states_);
+
+        pool.parallelFor(sequences.size(), 1, [&](size_t begin, size_t end, size_t) {
+            Matrix log_gamma;
+            for (size_t s = begin; s < end; ++s) {
+                if (sequences[s].rows() == 0) continue;
+                forwardBackwardLog(computeLogEmissions(sequences[s]), log_gamma);
+                proba.middleRows(offsets[s], sequences[s].rows()) = log_gamma.array().exp().matrix();
+            }
+        });
+    }
+
+    Scalar HMMRegimeDetector::fit(const Matrix& observations, int max_iter, Scalar tol) {
+        return fit(std::vector<Matrix>{observations}, max_iter, tol);
     }
 
-    void HMMRegimeDetector::fit(const Matrix& observations) {
-        std::cout << "Training logic would go here (Baum-Welch)." << std::endl;
+    Scalar HMMRegimeDetector::fit(const std::vector<Matrix>& sequences, int max_iter, Scalar tol, ThreadPool& pool) {
+        const int N = n_states_;
+        long D = -1;
+        long total_rows = 0;
+        for (const auto& seq : sequences) {
+            if (seq.rows() == 0) continue;
+            if (D >= 0 && seq.cols() != D) return 0.0; // Feature count must agree across sequences
+            D = seq.cols();
+            total_rows += seq.rows();
+        }
+        if (total_rows == 0 || D == 0) return 0.0;
+
+        // Centre the data once: scatter matrices are accumulated around this point,
+        // which avoids cancellation in E[xx^T] - mu mu^T for features far from zero
+        Vector centre = Vector::Zero(D);
+        for (const auto& seq : sequences) {
+            if (seq.rows() > 0) centre += seq.colwise().sum().transpose();
+        }
+        centre /= static_cast<Scalar>(total_rows);
+
+        std::vector<Matrix> centred(sequences.size());
+        for (size_t s = 0; s < sequences.size(); ++s) {
+            if (sequences[s].rows() > 0) centred[s] = sequences[s].rowwise() - centre.transpose();
+        }
+
+        const Scalar ridge = 1e-6;
+
+        // Initialisation (unless usable parameters were loaded)
+        if (n_features_ != D || means_.rows() != N) {
+            // Split pooled observations into N quantile groups of the first feature
+            std::vector<std::pair<Scalar, std::pair<size_t, long>>> keys;
+            keys.reserve(total_rows);
+            for (size_t s = 0; s < sequences.size(); ++s) {
+                for (long t = 0; t < sequences[s].rows(); ++t) {
+                    keys.push_back({sequences[s](t, 0), {s, t}});
+                }
+            }
+            std::sort(keys.begin(), keys.end());
+
+            Matrix pooled_cov = Matrix::Zero(D, D);
+            for (size_t s = 0; s < centred.size(); ++s) {
+                if (centred[s].rows() > 0) pooled_cov.noalias() += centred[s].transpose() * centred[s];
+            }
+            pooled_cov /= static_cast<Scalar>(total_rows);
+            pooled_cov.diagonal().array() += ridge;
+
+            Matrix means = Matrix::Zero(N, D);
+            Matrix variances(N * D, D);
+            for (int i = 0; i < N; ++i) {
+                size_t lo = keys.size() * i / N;
+                size_t hi = std::max(lo + 1, keys.size() * (i + 1) / N);
+                for (size_t k = lo; k < hi; ++k) {
+                    means.row(i) += sequences[keys[k].second.first].row(keys[k].second.second);
+                }
+                means.row(i) /= static_cast<Scalar>(hi - lo);
+                variances.block(i * D, 0, D, D) = pooled_cov;
+            }
+
+            Vector start = Vector::Constant(N, 1.0 / N);
+            Matrix trans = Matrix::Constant(N, N, N > 1 ? 0.1 / (N - 1) : 1.0);
+            if (N > 1) trans.diagonal().setConstant(0.9);
+
+            setParameters(start, trans, means, variances);
+        }
+
+        std::vector<SufficientStats> stats(sequences.size());
+        Scalar prev_ll = -std::numeric_limits<Scalar>::infinity();
+        Scalar ll = prev_ll;
+
+        for (int iter = 0; iter <= max_iter; ++iter) {
+            // E-step (parallel over sequences). Emissions are evaluated on the raw data;
+            // statistics are accumulated on the centred copy.
+            pool.parallelFor(sequences.size(), 1, [&](size_t begin, size_t end, size_t) {
+                for (size_t s = begin; s < end; ++s) {
+                    if (sequences[s].rows() == 0) continue;
+                    Matrix log_emit = computeLogEmissions(sequences[s]);
+                    accumulateStats(centred[s], log_emit, start_prob_, trans_mat_, stats[s]);
+                }
+            });
+
+            // Deterministic reduction in sequence order
+            Vector start_acc = Vector::Zero(N);
+            Matrix trans_acc = Matrix::Zero(N, N);
+            Vector occupancy = Vector::Zero(N);
+            Matrix weighted_sum = Matrix::Zero(N, D);
+            std::vector<Matrix> scatter(N, Matrix::Zero(D, D));
+            ll = 0.0;
+            int n_seq = 0;
+            for (size_t s = 0; s < sequences.size(); ++s) {
+                if (sequences[s].rows() == 0) continue;
+                const SufficientStats& st = stats[s];
+                start_acc += st.start;
+                trans_acc += st.trans;
+                occupancy += st.occupancy;
+                weighted_sum += st.weighted_sum;
+                for (int i = 0; i < N; ++i) scatter[i] += st.scatter[i];
+                ll += st.log_likelihood;
+                ++n_seq;
+            }
+
+            // Converged, out of iterations or numerical breakdown: keep the current parameters
+            if (!std::isfinite(ll) || (iter > 0 && ll - prev_ll < tol) || iter == max_iter) break;
+            prev_ll = ll;
+
+            // M-step
+            Vector start = start_acc / static_cast<Scalar>(n_seq);
+            Matrix trans = trans_mat_;
+            for (int i = 0; i < N; ++i) {
+                Scalar row_sum = trans_acc.row(i).sum();
+                if (row_sum > 0) trans.row(i) = trans_acc.row(i) / row_sum;
+            }
+
+            Matrix means = means_;
+            Matrix variances = variances_;
+            for (int i = 0; i < N; ++i) {
+                if (occupancy(i) < 1e-10) continue; // Empty state: keep previous emission
+                Vector mu_c = weighted_sum.row(i).transpose() / occupancy(i);
+                Matrix cov = scatter[i] / occupancy(i) - mu_c * mu_c.transpose();
+                cov = 0.5 * (cov + cov.transpose());
+                cov.diagonal().array() += ridge;
+                means.row(i) = (mu_c + centre).transpose();
+                variances.block(i * D, 0, D, D) = cov;
+            }
+
+            setParameters(start, trans, means, variances);
+        }
+
+        return ll;
     }
 
-}
\ No newline at end of file
+}
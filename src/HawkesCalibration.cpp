@@ -0,0 +1,252 @@
+#include "../include/adaptive_exec/HawkesCalibration.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace AdaptiveExec {
+
+    namespace {
+
+        using Vec3 = Eigen::Matrix<double, 3, 1>;
+        using Mat3 = Eigen::Matrix<double, 3, 3>;
+
+        // Events per block: exponentials / logs / reciprocals are vectorized per block
+        constexpr size_t kBlock = 4096;
+
+        // Multi-start runs on at most this many leading events; the winner is refined on all of them
+        constexpr size_t kScreenEvents = size_t(1) << 16;
+
+        // Stationarity: branching ratio alpha / beta stays below this
+        constexpr double kMaxBranching = 0.999;
+
+        // Box in log-parameter space plus the half-plane log(alpha) - log(beta) <= log(kMaxBranching)
+        struct LogBounds {
+            Vec3 lo;
+            Vec3 hi;
+
+            Vec3 project(Vec3 x) const {
+                for (int pass = 0; pass < 2; ++pass) {
+                    x = x.cwiseMax(lo).cwiseMin(hi);
+                    double excess = x(1) - x(2) - std::log(kMaxBranching);
+                    if (excess > 0.0) {
+                        x(1) -= 0.5 * excess;
+                        x(2) += 0.5 * excess;
+                    }
+                }
+                x = x.cwiseMax(lo).cwiseMin(hi);
+                if (x(1) - x(2) > std::log(kMaxBranching)) x(1) = x(2) + std::log(kMaxBranching);
+                return x;
+            }
+        };
+
+        // Negative log-likelihood per event in log-parameters, with gradient
+        double objective(const double* times, size_t n, double T, const Vec3& x, Vec3& g) {
+            double grad[3];
+            double mu = std::exp(x(0)), alpha = std::exp(x(1)), beta = std::exp(x(2));
+            double ll = HawkesCalibrator::logLikelihood(times, n, T, mu, alpha, beta, grad);
+            double scale = 1.0 / static_cast<double>(n);
+            g << -grad[0] * mu * scale, -grad[1] * alpha * scale, -grad[2] * beta * scale;
+            return std::isfinite(ll) ? -ll * scale : std::numeric_limits<double>::infinity();
+        }
+
+        // Projected BFGS with Armijo backtracking
+        HawkesFitResult minimize(const double* times, size_t n, double T, Vec3 x,
+                                 const LogBounds& bounds, int max_iter) {
+            x = bounds.project(x);
+            Vec3 g;
+            double f = objective(times, n, T, x, g);
+            Mat3 H = Mat3::Identity();
+
+            int iter = 0;
+            bool converged = false;
+            for (; iter < max_iter && std::isfinite(f); ++iter) {
+                // Projected-gradient stationarity
+                if ((bounds.project(x - g) - x).lpNorm<Eigen::Infinity>() < 1e-9) {
+                    converged = true;
+                    break;
+                }
+
+                Vec3 p = -H * g;
+                if (g.dot(p) >= 0.0) {
+                    H.setIdentity();
+                    p = -g;
+                }
+                // At most a factor e^2 per parameter per step
+                double p_max = p.lpNorm<Eigen::Infinity>();
+                if (p_max > 2.0) p *= 2.0 / p_max;
+
+                Vec3 x_new, g_new, s;
+                double f_new = f;
+                double step = 1.0;
+                bool accepted = false;
+                for (int ls = 0; ls < 40; ++ls) {
+                    x_new = bounds.project(x + step * p);
+                    s = x_new - x;
+                    if (s.lpNorm<Eigen::Infinity>() == 0.0) break;
+                    f_new = objective(times, n, T, x_new, g_new);
+                    if (f_new <= f + 1e-4 * g.dot(s)) {
+                        accepted = true;
+                        break;
+                    }
+                    step *= 0.5;
+                }
+                if (!accepted) {
+                    converged = true; // No further decrease possible inside the bounds
+                    break;
+                }
+
+                Vec3 y = g_new - g;
+                double sy = s.dot(y);
+                if (sy > 1e-12 * s.norm() * y.norm()) {
+                    double rho = 1.0 / sy;
+                    Mat3 V = Mat3::Identity() - rho * s * y.transpose();
+                    H = V * H * V.transpose() + rho * s * s.transpose();
+                }
+
+                bool small_step = s.lpNorm<Eigen::Infinity>() < 1e-10;
+                bool small_change = std::abs(f - f_new) <= 1e-14 * (1.0 + std::abs(f));
+                x = x_new;
+                f = f_new;
+                g = g_new;
+                if (small_step || small_change) {
+                    converged = true;
+                    ++iter;
+                    break;
+                }
+            }
+
+            HawkesFitResult res;
+            res.mu = std::exp(x(0));
+            res.alpha = std::exp(x(1));
+            res.beta = std::exp(x(2));
+            res.log_likelihood = std::isfinite(f) ? -f * static_cast<double>(n) : -std::numeric_limits<double>::infinity();
+            res.iterations = iter;
+            res.converged = converged;
+            return res;
+        }
+
+    }
+
+    double HawkesCalibrator::logLikelihood(const double* times, size_t n, double T,
+                                           double mu, double alpha, double beta, double* grad) {
+        if (grad) grad[0] = grad[1] = grad[2] = 0.0;
+        if (!(mu > 0.0) || !(alpha >= 0.0) || !(beta > 0.0)) return -std::numeric_limits<double>::infinity();
+        if (n == 0) {
+            if (grad) grad[0] = -T;
+            return -mu * T;
+        }
+
+        Eigen::ArrayXd dt(kBlock), decay(kBlock), A_buf(kBlock), B_buf(kBlock), lam(kBlock);
+
+        // Seeding A = -1 makes A_0 = e^0 (1 - 1) = 0 without a special case for the first event
+        double A = -1.0;
+        double B = 0.0;
+        double sum_log = 0.0, sum_inv = 0.0, sum_A_inv = 0.0, sum_B_inv = 0.0;
+
+        for (size_t start = 0; start < n; start += kBlock) {
+            const size_t len = std::min(kBlock, n - start);
+            for (size_t k = 0; k < len; ++k) {
+                size_t i = start + k;
+                dt[k] = (i == 0) ? 0.0 : std::max(0.0, times[i] - times[i - 1]);
+            }
+            // Capping the exponent keeps A and B out of the (slow) subnormal range; e^-600 is
+            // already negligible against mu in every intensity
+            decay.head(len) = (-(beta * dt.head(len)).min(600.0)).exp();
+
+            // Sequential part: A_i = d (1 + A_{i-1}), B_i = d (B_{i-1} + dt (1 + A_{i-1}))
+            for (size_t k = 0; k < len; ++k) {
+                double one_plus_A = 1.0 + A;
+                double d = decay[k];
+                B = d * (B + dt[k] * one_plus_A);
+                A = d * one_plus_A;
+                A_buf[k] = A;
+                B_buf[k] = B;
+            }
+
+            lam.head(len) = mu + alpha * A_buf.head(len);
+            sum_log += lam.head(len).log().sum();
+            if (grad) {
+                lam.head(len) = lam.head(len).inverse();
+                sum_inv += lam.head(len).sum();
+                sum_A_inv += (A_buf.head(len) * lam.head(len)).sum();
+                sum_B_inv += (B_buf.head(len) * lam.head(len)).sum();
+            }
+        }
+
+        // Compensator sums from the last state:
+        // sum_i e^{-beta (T - t_i)} = E (1 + A_N), sum_i (T - t_i) e^{-beta (T - t_i)} = E ((T - t_N)(1 + A_N) + B_N)
+        double tail = std::max(0.0, T - times[n - 1]);
+        double E = std::exp(-beta * tail);
+        double S1 = static_cast<double>(n) - E * (1.0 + A);
+        double S2 = E * (tail * (1.0 + A) + B);
+
+        double ll = sum_log - mu * T - (alpha / beta) * S1;
+
+        if (grad) {
+            grad[0] = sum_inv - T;
+            grad[1] = sum_A_inv - S1 / beta;
+            grad[2] = -alpha * sum_B_inv + (alpha / (beta * beta)) * S1 - (alpha / beta) * S2;
+        }
+        return ll;
+    }
+
+    double HawkesCalibrator::logLikelihood(const std::vector<double>& times, double T,
+                                           double mu, double alpha, double beta, double* grad) {
+        return logLikelihood(times.data(), times.size(), T, mu, alpha, beta, grad);
+    }
+
+    HawkesFitResult HawkesCalibrator::fit(const double* times, size_t n, double T, int n_starts,
+                                          int max_iter, ThreadPool& pool) {
+        HawkesFitResult best{0.0, 0.0, 0.0, -std::numeric_limits<double>::infinity(), 0, false};
+        if (n < 2 || !(T > 0.0)) return best;
+
+        // Everything is scaled by the mean event rate
+        const double rate = static_cast<double>(n) / T;
+        LogBounds bounds;
+        bounds.lo << std::log(1e-6 * rate), std::log(1e-10 * rate), std::log(1e-6 * rate);
+        bounds.hi << std::log(10.0 * rate), std::log(1e6 * rate), std::log(1e6 * rate);
+
+        // Deterministic grid: decay rate relative to the event rate x branching ratio
+        const double beta_mult[] = {1.0, 10.0, 0.1, 100.0, 1000.0, 0.01};
+        const double branching[] = {0.5, 0.2, 0.8};
+        std::vector<Vec3> starts;
+        n_starts = std::max(1, n_starts);
+        for (int k = 0; k < n_starts; ++k) {
+            double beta0 = beta_mult[k % 6] * rate;
+            double n0 = branching[(k / 6 + k) % 3];
+            Vec3 x0;
+            x0 << std::log((1.0 - n0) * rate), std::log(n0 * beta0), std::log(beta0);
+            starts.push_back(x0);
+        }
+
+        // Long sessions: screen the starts on the likelihood of the leading events only
+        // (an exact Hawkes likelihood on [0, t_m)), then refine the winner on the full session
+        const bool screen = n > 2 * kScreenEvents;
+        const size_t n_screen = screen ? kScreenEvents : n;
+        const double T_screen = screen ? times[kScreenEvents] : T;
+
+        std::vector<HawkesFitResult> results(starts.size());
+        pool.parallelFor(starts.size(), 1, [&](size_t begin, size_t end, size_t) {
+            for (size_t k = begin; k < end; ++k) {
+                results[k] = minimize(times, n_screen, T_screen, starts[k], bounds, max_iter);
+            }
+        });
+
+        // Best likelihood; ties go to the earlier start so the result does not depend on threads
+        for (const HawkesFitResult& r : results) {
+            if (r.log_likelihood > best.log_likelihood) best = r;
+        }
+        if (screen && std::isfinite(best.log_likelihood)) {
+            Vec3 x0;
+            x0 << std::log(best.mu), std::log(best.alpha), std::log(best.beta);
+            best = minimize(times, n, T, x0, bounds, max_iter);
+        }
+        return best;
+    }
+
+    HawkesFitResult HawkesCalibrator::fit(const std::vector<double>& times, double T, int n_starts,
+                                          int max_iter, ThreadPool& pool) {
+        return fit(times.data(), times.size(), T, n_starts, max_iter, pool);
+    }
+
+}
@@ -0,0 +1,112 @@
+#include "../include/adaptive_exec/HawkesSimulator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace AdaptiveExec {
+
+    namespace {
+
+        uint64_t splitMix64(uint64_t& state) {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        // xoshiro256**: small state, fast, and fully specified (same stream on every platform)
+        class Xoshiro256 {
+        public:
+            explicit Xoshiro256(uint64_t seed) {
+                for (uint64_t& word : s_) word = splitMix64(seed);
+            }
+
+            uint64_t next() {
+                const uint64_t result = rotl(s_[1] * 5, 7) * 9;
+                const uint64_t t = s_[1] << 17;
+                s_[2] ^= s_[0];
+                s_[3] ^= s_[1];
+                s_[1] ^= s_[2];
+                s_[0] ^= s_[3];
+                s_[2] ^= t;
+                s_[3] = rotl(s_[3], 45);
+                return result;
+            }
+
+            // Uniform in (0, 1]: safe to take the log of
+            double uniform() { return (static_cast<double>(next() >> 11) + 1.0) * 0x1.0p-53; }
+
+        private:
+            static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+            uint64_t s_[4];
+        };
+
+    }
+
+    HawkesSimulator::HawkesSimulator(double baseline, double alpha, double beta)
+        : mu_(baseline), alpha_(alpha), beta_(beta) {}
+
+    uint64_t HawkesSimulator::streamSeed(uint64_t seed, uint64_t stream) {
+        uint64_t state = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+        return splitMix64(state);
+    }
+
+    template <typename OnEvent>
+    void HawkesSimulator::run(double T, uint64_t seed, OnEvent&& on_event) const {
+        if (!(mu_ > 0.0) || !(beta_ > 0.0) || !(T > 0.0)) return;
+
+        Xoshiro256 rng(seed);
+        const double inf = std::numeric_limits<double>::infinity();
+        double t = 0.0;
+        double excite = 0.0; // lambda - mu just after the last event
+
+        while (true) {
+            double s1 = -std::log(rng.uniform()) / mu_;
+            double u2 = rng.uniform();
+            double s2 = inf;
+            if (excite > 0.0) {
+                double d = 1.0 + beta_ * std::log(u2) / excite;
+                if (d > 0.0) s2 = -std::log(d) / beta_;
+            }
+
+            double s = std::min(s1, s2);
+            t += s;
+            if (t > T) break;
+
+            excite = excite * std::exp(-beta_ * s) + alpha_;
+            on_event(t, mu_ + excite);
+        }
+    }
+
+    size_t HawkesSimulator::simulate(double T, uint64_t seed, std::vector<double>& times) const {
+        times.clear();
+        run(T, seed, [&](double t, double) { times.push_back(t); });
+        return times.size();
+    }
+
+    HawkesSessionStats HawkesSimulator::simulateSession(double T, double threshold, uint64_t seed) const {
+        HawkesSessionStats stats{0, 0, mu_, -1.0};
+        run(T, seed, [&](double t, double intensity) {
+            ++stats.n_events;
+            if (intensity > stats.max_intensity) stats.max_intensity = intensity;
+            if (intensity > threshold) {
+                if (stats.n_triggers == 0) stats.first_trigger = t;
+                ++stats.n_triggers;
+            }
+        });
+        return stats;
+    }
+
+    std::vector<HawkesSessionStats> HawkesSimulator::simulateSessions(size_t n_sessions, double T, double threshold,
+                                                                      uint64_t seed, ThreadPool& pool) const {
+        std::vector<HawkesSessionStats> results(n_sessions);
+        pool.parallelFor(n_sessions, 16, [&](size_t begin, size_t end, size_t) {
+            for (size_t s = begin; s < end; ++s) {
+                results[s] = simulateSession(T, threshold, streamSeed(seed, s));
+            }
+        });
+        return results;
+    }
+
+}
@@ -0,0 +1,96 @@
+#include "../include/adaptive_exec/MultivariateHawkesModel.hpp"
+#include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cmath>
+
+namespace AdaptiveExec {
+
+    MultivariateHawkesModel::MultivariateHawkesModel(const Vector& baseline, const Matrix& alpha, const Vector& beta)
+        : mu_(baseline), alpha_(alpha), beta_(beta),
+          last_event_time_(0.0), excite_(Vector::Zero(baseline.size())) {
+        uniform_beta_ = beta_.size() > 0 && (beta_.array() == beta_(0)).all();
+    }
+
+    double MultivariateHawkesModel::addEvent(double timestamp, int dim) {
+        if (dim < 0 || dim >= dimension()) return 0.0;
+
+        double dt = timestamp - last_event_time_;
+        if (dt < 0) dt = 0; // Protection against out-of-order
+
+        // Decay all excitations to the new event, then jump by the source column
+        if (dt > 0) {
+            if (uniform_beta_) {
+                excite_ *= std::exp(-beta_(0) * dt);
+            } else {
+                excite_.array() *= (-dt * beta_.array()).exp();
+            }
+        }
+        excite_ += alpha_.col(dim);
+        last_event_time_ = timestamp;
+
+        return mu_(dim) + excite_(dim);
+    }
+
+    void MultivariateHawkesModel::addEvents(const double* timestamps, const int* dims, size_t n) {
+        for (size_t k = 0; k < n; ++k) addEvent(timestamps[k], dims[k]);
+    }
+
+    void MultivariateHawkesModel::decayedExcitation(double timestamp, Vector& out) const {
+        double dt = timestamp - last_event_time_;
+        if (dt <= 0) {
+            out = excite_;
+        } else if (uniform_beta_) {
+            out = excite_ * std::exp(-beta_(0) * dt);
+        } else {
+            out.array() = excite_.array() * (-dt * beta_.array()).exp();
+        }
+    }
+
+    void MultivariateHawkesModel::getIntensity(double timestamp, Vector& out) const {
+        decayedExcitation(timestamp, out);
+        out += mu_;
+    }
+
+    double MultivariateHawkesModel::getIntensity(double timestamp, int dim) const {
+        if (dim < 0 || dim >= dimension()) return 0.0;
+        double dt = timestamp - last_event_time_;
+        if (dt < 0) dt = 0;
+        return mu_(dim) + excite_(dim) * std::exp(-beta_(dim) * dt);
+    }
+
+    // The queries below evaluate the decayed intensities as expressions, without any shared
+    // buffer, so concurrent readers never write to the model
+
+    double MultivariateHawkesModel::getTotalIntensity(double timestamp) const {
+        double dt = std::max(0.0, timestamp - last_event_time_);
+        if (uniform_beta_) return mu_.sum() + (excite_ * std::exp(-beta_(0) * dt)).sum();
+        return mu_.sum() + (excite_.array() * (-dt * beta_.array()).exp()).sum();
+    }
+
+    bool MultivariateHawkesModel::isCritical(double timestamp, double threshold) const {
+        double dt = std::max(0.0, timestamp - last_event_time_);
+        if (uniform_beta_) return ((mu_.array() + excite_.array() * std::exp(-beta_(0) * dt)) > threshold).any();
+        return ((mu_.array() + excite_.array() * (-dt * beta_.array()).exp()) > threshold).any();
+    }
+
+    bool MultivariateHawkesModel::isCritical(double timestamp, const Vector& thresholds) const {
+        double dt = std::max(0.0, timestamp - last_event_time_);
+        if (uniform_beta_) {
+            return ((mu_.array() + excite_.array() * std::exp(-beta_(0) * dt)) > thresholds.array()).any();
+        }
+        return ((mu_.array() + excite_.array() * (-dt * beta_.array()).exp()) > thresholds.array()).any();
+    }
+
+    void MultivariateHawkesModel::reset() {
+        last_event_time_ = 0.0;
+        excite_.setZero();
+    }
+
+    Scalar MultivariateHawkesModel::branchingRatio() const {
+        if (mu_.size() == 0) return 0.0;
+        Matrix branching = beta_.cwiseInverse().asDiagonal() * alpha_;
+        Eigen::EigenSolver<Matrix> solver(branching, false);
+        return solver.eigenvalues().cwiseAbs().maxCoeff();
+    }
+
+}
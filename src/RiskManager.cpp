@@ -6,19 +6,26 @@
 namespace AdaptiveExec {
 
     Scalar RiskManager::computeCVaR(const std::vector<Scalar>& returns, Scalar alpha) {
-        if (returns.empty()) return 0.0;
+        return computeCVaR(returns.data(), returns.size(), alpha);
+    }
 
-        std::vector<Scalar> sorted_rets = returns;
-        std::sort(sorted_rets.begin(), sorted_rets.end());
+    Scalar RiskManager::computeCVaR(const Scalar* returns, size_t n, Scalar alpha) {
+        if (n == 0) return 0.0;
 
         // Index for alpha percentile
-        size_t cutoff_idx = static_cast<size_t>(std::ceil(alpha * sorted_rets.size()));
+        size_t cutoff_idx = static_cast<size_t>(std::ceil(alpha * n));
         if (cutoff_idx == 0) cutoff_idx = 1;
+        if (cutoff_idx > n) cutoff_idx = n;
+
+        // Only the tail set matters, not its order: nth_element instead of a full sort
+        thread_local std::vector<Scalar> scratch;
+        scratch.assign(returns, returns + n);
+        std::nth_element(scratch.begin(), scratch.begin() + (cutoff_idx - 1), scratch.end());
 
         // CVaR = -Mean of returns below cutoff
         Scalar sum_tail = 0.0;
         for (size_t i = 0; i < cutoff_idx; ++i) {
-            sum_tail += sorted_rets[i];
+            sum_tail += scratch[i];
         }
 
         return -(sum_tail / cutoff_idx);
@@ -3,26 +3,142 @@
 #include <numeric>
 #include <algorithm>
 
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace AdaptiveExec {
 
-    Scalar VolatilityEstimators::sumSquares(const std::vector<Scalar>& data) {
+    namespace {
+
+        // Raw sums shared by the fused feature kernel
+        struct FeatureSums {
+            Scalar sum_sq = 0.0;       // Sum r_i^2
+            Scalar sum_abs_prod = 0.0; // Sum |r_i||r_{i-1}|
+            Scalar sum_med_sq = 0.0;   // Sum med(|r_i|, |r_{i-1}|, |r_{i-2}|)^2
+            Scalar sum_sub_sq = 0.0;   // Sum r_i^2 for i = 0, K, 2K, ...
+        };
+
+        // Block size (in returns) kept hot in L1 between the dense and the strided sweep
+        constexpr size_t kFeatureBlock = 2048;
+
+        inline Scalar median3(Scalar a, Scalar b, Scalar c) {
+            return std::max(std::min(a, b), std::min(std::max(a, b), c));
+        }
+
+        // Dense part of the fused kernel over [begin, end), requires begin >= 2
+        void accumulateDense(const Scalar* x, size_t begin, size_t end, FeatureSums& s) {
+            size_t i = begin;
+
+#if defined(__AVX512F__)
+            const __m512d sign = _mm512_set1_pd(-0.0);
+            __m512d acc_sq = _mm512_setzero_pd();
+            __m512d acc_bp = _mm512_setzero_pd();
+            __m512d acc_med = _mm512_setzero_pd();
+            for (; i + 8 <= end; i += 8) {
+                __m512d r0 = _mm512_loadu_pd(x + i);
+                __m512d a0 = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(sign), _mm512_castpd_si512(r0)));
+                __m512d a1 = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(sign), _mm512_castpd_si512(_mm512_loadu_pd(x + i - 1))));
+                __m512d a2 = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(sign), _mm512_castpd_si512(_mm512_loadu_pd(x + i - 2))));
+                __m512d med = _mm512_max_pd(_mm512_min_pd(a0, a1), _mm512_min_pd(_mm512_max_pd(a0, a1), a2));
+                acc_sq = _mm512_fmadd_pd(r0, r0, acc_sq);
+                acc_bp = _mm512_fmadd_pd(a0, a1, acc_bp);
+                acc_med = _mm512_fmadd_pd(med, med, acc_med);
+            }
+            s.sum_sq += _mm512_reduce_add_pd(acc_sq);
+            s.sum_abs_prod += _mm512_reduce_add_pd(acc_bp);
+            s.sum_med_sq += _mm512_reduce_add_pd(acc_med);
+#elif defined(__AVX2__)
+            const __m256d sign = _mm256_set1_pd(-0.0);
+            __m256d acc_sq = _mm256_setzero_pd();
+            __m256d acc_bp = _mm256_setzero_pd();
+            __m256d acc_med = _mm256_setzero_pd();
+            for (; i + 4 <= end; i += 4) {
+                __m256d r0 = _mm256_loadu_pd(x + i);
+                __m256d a0 = _mm256_andnot_pd(sign, r0);
+                __m256d a1 = _mm256_andnot_pd(sign, _mm256_loadu_pd(x + i - 1));
+                __m256d a2 = _mm256_andnot_pd(sign, _mm256_loadu_pd(x + i - 2));
+                __m256d med = _mm256_max_pd(_mm256_min_pd(a0, a1), _mm256_min_pd(_mm256_max_pd(a0, a1), a2));
+#if defined(__FMA__)
+                acc_sq = _mm256_fmadd_pd(r0, r0, acc_sq);
+                acc_bp = _mm256_fmadd_pd(a0, a1, acc_bp);
+                acc_med = _mm256_fmadd_pd(med, med, acc_med);
+#else
+                acc_sq = _mm256_add_pd(acc_sq, _mm256_mul_pd(r0, r0));
+                acc_bp = _mm256_add_pd(acc_bp, _mm256_mul_pd(a0, a1));
+                acc_med = _mm256_add_pd(acc_med, _mm256_mul_pd(med, med));
+#endif
+            }
+            alignas(32) Scalar lanes[4];
+            _mm256_store_pd(lanes, acc_sq);
+            s.sum_sq += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            _mm256_store_pd(lanes, acc_bp);
+            s.sum_abs_prod += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            _mm256_store_pd(lanes, acc_med);
+            s.sum_med_sq += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+
+            // Scalar fallback / remainder
+            for (; i < end; ++i) {
+                Scalar a0 = std::abs(x[i]);
+                Scalar a1 = std::abs(x[i-1]);
+                Scalar med = median3(a0, a1, std::abs(x[i-2]));
+                s.sum_sq += x[i] * x[i];
+                s.sum_abs_prod += a0 * a1;
+                s.sum_med_sq += med * med;
+            }
+        }
+
+    }
+
+    Scalar VolatilityEstimators::sumSquares(const Scalar* data, size_t n) {
         Scalar sum = 0.0;
-        for (Scalar val : data) {
-            sum += val * val;
+        for (size_t i = 0; i < n; ++i) {
+            sum += data[i] * data[i];
         }
         return sum;
     }
 
+    // --- std::vector entry points (forward to the pointer + length views) ---
+
     Scalar VolatilityEstimators::computeRV(const std::vector<Scalar>& returns, Scalar annualization_factor) {
-        Scalar rv = sumSquares(returns);
-        return rv * annualization_factor;
+        return computeRV(returns.data(), returns.size(), annualization_factor);
     }
 
     Scalar VolatilityEstimators::computeBV(const std::vector<Scalar>& returns, Scalar annualization_factor) {
-        if (returns.size() < 2) return 0.0;
+        return computeBV(returns.data(), returns.size(), annualization_factor);
+    }
+
+    Scalar VolatilityEstimators::computeMedRV(const std::vector<Scalar>& returns, Scalar annualization_factor) {
+        return computeMedRV(returns.data(), returns.size(), annualization_factor);
+    }
+
+    Scalar VolatilityEstimators::computeRJ(const std::vector<Scalar>& returns, Scalar annualization_factor) {
+        return computeRJ(returns.data(), returns.size(), annualization_factor);
+    }
+
+    Scalar VolatilityEstimators::computeTSRV(const std::vector<Scalar>& returns, int K, Scalar annualization_factor) {
+        return computeTSRV(returns.data(), returns.size(), K, annualization_factor);
+    }
+
+    std::vector<Scalar> VolatilityEstimators::computeLeeMykland(const std::vector<Scalar>& returns, size_t window_size) {
+        std::vector<Scalar> statistics(returns.size(), 0.0);
+        computeLeeMykland(returns.data(), returns.size(), statistics.data(), window_size);
+        return statistics;
+    }
+
+    // --- Zero-copy views ---
+
+    Scalar VolatilityEstimators::computeRV(const Scalar* returns, size_t n, Scalar annualization_factor) {
+        Scalar rv = sumSquares(returns, n);
+        return rv * annualization_factor;
+    }
+
+    Scalar VolatilityEstimators::computeBV(const Scalar* returns, size_t n, Scalar annualization_factor) {
+        if (n < 2) return 0.0;
         
         Scalar sum_abs_prod = 0.0;
-        for (size_t i = 0; i < returns.size() - 1; ++i) {
+        for (size_t i = 0; i < n - 1; ++i) {
             sum_abs_prod += std::abs(returns[i]) * std::abs(returns[i+1]);
         }
         
@@ -30,14 +146,14 @@ namespace AdaptiveExec {
         return bv * annualization_factor;
     }
 
-    Scalar VolatilityEstimators::computeMedRV(const std::vector<Scalar>& returns, Scalar annualization_factor) {
-        if (returns.size() < 3) return 0.0;
+    Scalar VolatilityEstimators::computeMedRV(const Scalar* returns, size_t n, Scalar annualization_factor) {
+        if (n < 3) return 0.0;
 
         Scalar sum_med_sq = 0.0;
         Scalar scale_factor = (M_PI) / (6.0 - 4.0 * std::sqrt(3.0) + M_PI); // Approx 1.419
-        Scalar correction = static_cast<Scalar>(returns.size()) / static_cast<Scalar>(returns.size() - 2);
+        Scalar correction = static_cast<Scalar>(n) / static_cast<Scalar>(n - 2);
 
-        for (size_t i = 2; i < returns.size(); ++i) {
+        for (size_t i = 2; i < n; ++i) {
             Scalar a = std::abs(returns[i]);
             Scalar b = std::abs(returns[i-1]);
             Scalar c = std::abs(returns[i-2]);
@@ -54,29 +170,39 @@ namespace AdaptiveExec {
         return scale_factor * correction * sum_med_sq * annualization_factor;
     }
 
-    std::vector<Scalar> VolatilityEstimators::computeLeeMykland(const std::vector<Scalar>& returns, size_t window_size) {
-        std::vector<Scalar> statistics(returns.size(), 0.0);
-        if (returns.size() <= window_size + 1) return statistics;
+    void VolatilityEstimators::computeLeeMykland(const Scalar* returns, size_t n, Scalar* statistics, size_t window_size) {
+        std::fill(statistics, statistics + n, 0.0);
+        if (n <= window_size + 1) return;
+
+        // Window of returns r[i-K], ..., r[i-1] gives K-1 adjacent pairs for BV
+        if (window_size < 2) return;
+        const size_t valid_pairs = window_size - 1;
 
         // Pre-compute constant for local BV
         Scalar c_bv = M_PI / 2.0;
 
-        for (size_t i = window_size; i < returns.size(); ++i) {
-            // Compute Local Volatility using BV over [i - window_size, i - 1]
-            Scalar local_bv_sum = 0.0;
-            // Iterate window. If window_size is K, we need K-1 products for BV
-            // Window of returns: r[i-K], ..., r[i-1]
-            // We need pairs (r[j], r[j+1])
-            
-            size_t start_idx = i - window_size;
-            size_t valid_pairs = 0;
-
-            for (size_t j = start_idx; j < i - 1; ++j) {
-                local_bv_sum += std::abs(returns[j]) * std::abs(returns[j+1]);
-                valid_pairs++;
+        // Sum of |r[j]| * |r[j+1]| for j in [i - K, i - 2]
+        auto windowSum = [&](size_t i) {
+            Scalar sum = 0.0;
+            for (size_t j = i - window_size; j < i - 1; ++j) {
+                sum += std::abs(returns[j]) * std::abs(returns[j+1]);
             }
+            return sum;
+        };
 
-            if (valid_pairs == 0) continue;
+        // Rolling sum: O(N) instead of O(N * K). The sum is re-anchored with an exact
+        // recomputation every K steps so that add/remove rounding cannot accumulate
+        // (amortized cost stays O(1) per index).
+        Scalar local_bv_sum = 0.0;
+        for (size_t i = window_size; i < n; ++i) {
+            if ((i - window_size) % window_size == 0) {
+                local_bv_sum = windowSum(i);
+            } else {
+                // Slide window by one: pair (i-2, i-1) enters, pair (i-K-1, i-K) leaves
+                local_bv_sum += std::abs(returns[i-2]) * std::abs(returns[i-1]);
+                local_bv_sum -= std::abs(returns[i-window_size-1]) * std::abs(returns[i-window_size]);
+                if (local_bv_sum < 0.0) local_bv_sum = 0.0;
+            }
 
             Scalar local_variance = c_bv * (local_bv_sum / static_cast<Scalar>(valid_pairs));
             Scalar local_vol = std::sqrt(local_variance);
@@ -87,21 +213,19 @@ namespace AdaptiveExec {
                 statistics[i] = 0.0;
             }
         }
-        return statistics;
     }
 
-    Scalar VolatilityEstimators::computeRJ(const std::vector<Scalar>& returns, Scalar annualization_factor) {
-        Scalar rv = computeRV(returns, annualization_factor);
-        Scalar bv = computeBV(returns, annualization_factor);
+    Scalar VolatilityEstimators::computeRJ(const Scalar* returns, size_t n, Scalar annualization_factor) {
+        Scalar rv = computeRV(returns, n, annualization_factor);
+        Scalar bv = computeBV(returns, n, annualization_factor);
         return std::max(0.0, rv - bv);
     }
 
-    Scalar VolatilityEstimators::computeTSRV(const std::vector<Scalar>& returns, int K, Scalar annualization_factor) {
-        size_t n = returns.size();
+    Scalar VolatilityEstimators::computeTSRV(const Scalar* returns, size_t n, int K, Scalar annualization_factor) {
         if (n < (size_t)K) return 0.0;
 
         // RV all
-        Scalar rv_all = sumSquares(returns);
+        Scalar rv_all = sumSquares(returns, n);
 
         // RV subsampled (every Kth)
         Scalar rv_sub = 0.0;
@@ -124,4 +248,145 @@ namespace AdaptiveExec {
         return std::max(0.0, tsrv) * annualization_factor;
     }
 
+    VolatilityFeatures VolatilityEstimators::computeFeatures(const std::vector<Scalar>& returns, int K, Scalar annualization_factor) {
+        return computeFeatures(returns.data(), returns.size(), K, annualization_factor);
+    }
+
+    VolatilityFeatures VolatilityEstimators::computeFeatures(const Scalar* returns, size_t n, int K, Scalar annualization_factor) {
+        VolatilityFeatures f = {0.0, 0.0, 0.0, 0.0, 0.0};
+        if (n == 0) return f;
+        const size_t step = static_cast<size_t>(std::max(1, K));
+
+        FeatureSums s;
+
+        // Head: first two returns have no full median/bipower neighbourhood
+        s.sum_sq += returns[0] * returns[0];
+        if (n > 1) {
+            s.sum_sq += returns[1] * returns[1];
+            s.sum_abs_prod += std::abs(returns[1]) * std::abs(returns[0]);
+        }
+
+        // Single pass in L1-sized blocks: dense SIMD sweep, then the TSRV
+        // subsampled grid of the same block while it is still cached.
+        size_t next_sub = 0;
+        for (size_t block = 0; block < n; block += kFeatureBlock) {
+            size_t end = std::min(n, block + kFeatureBlock);
+            accumulateDense(returns, std::max<size_t>(block, 2), end, s);
+            for (; next_sub < end; next_sub += step) {
+                s.sum_sub_sq += returns[next_sub] * returns[next_sub];
+            }
+        }
+
+        f.rv = s.sum_sq * annualization_factor;
+
+        if (n >= 2) {
+            f.bv = (M_PI / 2.0) * s.sum_abs_prod * annualization_factor;
+        }
+
+        if (n >= 3) {
+            Scalar scale_factor = (M_PI) / (6.0 - 4.0 * std::sqrt(3.0) + M_PI);
+            Scalar correction = static_cast<Scalar>(n) / static_cast<Scalar>(n - 2);
+            f.medrv = scale_factor * correction * s.sum_med_sq * annualization_factor;
+        }
+
+        f.rj = std::max(0.0, f.rv - f.bv);
+
+        if (n >= step) {
+            Scalar rv_sub = s.sum_sub_sq * static_cast<Scalar>(step);
+            Scalar term2 = (rv_sub / static_cast<Scalar>(n)) * (static_cast<Scalar>(n - step + 1)) / static_cast<Scalar>(step);
+            f.tsrv = std::max(0.0, s.sum_sq - term2) * annualization_factor;
+        }
+
+        return f;
+    }
+
+    NoiseRobustFeatures VolatilityEstimators::computeNoiseRobust(const std::vector<Scalar>& returns, int K, int M, int H, Scalar annualization_factor) {
+        return computeNoiseRobust(returns.data(), returns.size(), K, M, H, annualization_factor);
+    }
+
+    NoiseRobustFeatures VolatilityEstimators::computeNoiseRobust(const Scalar* returns, size_t n, int K, int M, int H, Scalar annualization_factor) {
+        NoiseRobustFeatures f = {0.0, 0.0, 0.0};
+        K = std::max(2, K);
+        M = std::max(2, M);
+        H = std::max(0, H);
+        if (n < static_cast<size_t>(std::max(K, M))) return f;
+
+        // Averaged-grid RV at scale k: [Y,Y]^(k) = (1/k) * sum_{j>=k} (Y_j - Y_{j-k})^2,
+        // where Y is the cumulative log price. Every return is read once. Only the scales
+        // that are used are accumulated: 1..M for MSRV plus K for TSRV, so the work is
+        // O(N * (M + H)) whatever K is. The last max(K, M) prices and H returns are kept
+        // in ring buffers inside a per-thread scratch buffer that is reused across calls
+        // (steady-state calls do not allocate).
+        const size_t scale_k = static_cast<size_t>(K);
+        const size_t n_scales = static_cast<size_t>(M);
+        const size_t price_ring = static_cast<size_t>(std::max(K, M)) + 1;
+        const size_t ret_ring = static_cast<size_t>(H) + 1;
+
+        thread_local std::vector<Scalar> scratch;
+        scratch.assign(price_ring + ret_ring + (n_scales + 1) + ret_ring, 0.0);
+        Scalar* prices = scratch.data();              // prices[j % price_ring] = Y_j, Y_0 = 0
+        Scalar* lagged = prices + price_ring;         // lagged[i % ret_ring] = r_i
+        Scalar* scale_sq = lagged + ret_ring;         // scale_sq[k], k = 1..M
+        Scalar* gamma = scale_sq + n_scales + 1;      // gamma_h = sum r_i r_{i-h}
+        Scalar sq_k = 0.0;                            // Scale K when K > M
+
+        Scalar y = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            const Scalar r = returns[i];
+            const size_t j = i + 1; // Y_j after this return
+            y += r;
+            prices[j % price_ring] = y;
+
+            const size_t max_k = std::min(n_scales, j);
+            for (size_t k = 1; k <= max_k; ++k) {
+                Scalar d = y - prices[(j - k) % price_ring];
+                scale_sq[k] += d * d;
+            }
+            if (scale_k > n_scales && j >= scale_k) {
+                Scalar d = y - prices[(j - scale_k) % price_ring];
+                sq_k += d * d;
+            }
+
+            lagged[i % ret_ring] = r;
+            const size_t max_h = std::min(static_cast<size_t>(H), i);
+            gamma[0] += r * r;
+            for (size_t h = 1; h <= max_h; ++h) {
+                gamma[h] += r * lagged[(i - h) % ret_ring];
+            }
+        }
+
+        auto averagedRV = [&](size_t k) { return scale_sq[k] / static_cast<Scalar>(k); };
+        const Scalar dn = static_cast<Scalar>(n);
+
+        // TSRV (all grids): ([Y,Y]^(K) - (n_bar / n) [Y,Y]^(1)) / (1 - n_bar / n)
+        Scalar n_bar = static_cast<Scalar>(n - K + 1) / static_cast<Scalar>(K);
+        Scalar ratio = n_bar / dn;
+        Scalar rv_k = (scale_k > n_scales) ? sq_k / static_cast<Scalar>(K) : averagedRV(scale_k);
+        f.tsrv = std::max(0.0, (rv_k - ratio * averagedRV(1)) / (1.0 - ratio));
+
+        // MSRV: weights sum to one and cancel the noise term (sum a_i / i = 0)
+        Scalar dm = static_cast<Scalar>(M);
+        Scalar msrv = 0.0;
+        for (int i = 1; i <= M; ++i) {
+            Scalar x = static_cast<Scalar>(i) / dm;
+            Scalar a = 12.0 * (static_cast<Scalar>(i) / (dm * dm)) * (x - 0.5 - 1.0 / (2.0 * dm)) / (1.0 - 1.0 / (dm * dm));
+            msrv += a * averagedRV(i);
+        }
+        f.msrv = std::max(0.0, msrv);
+
+        // Parzen kernel weights
+        Scalar rk = gamma[0];
+        for (int h = 1; h <= H; ++h) {
+            Scalar x = static_cast<Scalar>(h) / static_cast<Scalar>(H + 1);
+            Scalar w = (x <= 0.5) ? 1.0 - 6.0 * x * x + 6.0 * x * x * x : 2.0 * (1.0 - x) * (1.0 - x) * (1.0 - x);
+            rk += 2.0 * w * gamma[h];
+        }
+        f.realized_kernel = std::max(0.0, rk);
+
+        f.tsrv *= annualization_factor;
+        f.msrv *= annualization_factor;
+        f.realized_kernel *= annualization_factor;
+        return f;
+    }
+
 }
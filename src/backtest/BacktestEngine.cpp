@@ -1,4 +1,5 @@
 #include "../../include/adaptive_exec/backtest/BacktestEngine.hpp"
+#include "../../include/adaptive_exec/utils/KillSwitch.hpp"
 #include <iostream>
 
 namespace AdaptiveExec {
@@ -17,6 +18,7 @@ namespace AdaptiveExec {
 
     void BacktestEngine::executeOrder(int day, Scalar price, Scalar quantity, MarketRegime regime) {
         if (std::abs(quantity) < 1e-6) return; // No trade
+        if (KillSwitch::global().isTripped()) return; // Trading halted
 
         // Calculate Cost
         // Cost in bps relative to notional value
@@ -0,0 +1,117 @@
+#include "../../include/adaptive_exec/backtest/HARWalkForward.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace AdaptiveExec {
+
+    namespace {
+
+        using Vec5 = Eigen::Matrix<Scalar, 5, 1>;
+        using Mat5 = Eigen::Matrix<Scalar, 5, 5>;
+
+        // Sum of x x^T and x y over samples [begin, end)
+        void windowSums(const Matrix& X, const Vector& y, long begin, long end, Mat5& xtx, Vec5& xty) {
+            xtx.setZero();
+            xty.setZero();
+            for (long j = begin; j < end; ++j) {
+                Vec5 x = X.row(j).transpose();
+                xtx.noalias() += x * x.transpose();
+                xty.noalias() += x * y(j);
+            }
+        }
+
+    }
+
+    WalkForwardResult HARWalkForward::run(const VectorView& rv, const VectorView& rj, size_t window) {
+        WalkForwardResult res;
+        res.symbol = 0;
+        res.window = window;
+        res.first_day = 0;
+        res.mse = 0.0;
+        res.qlike = 0.0;
+
+        HARModel model;
+        auto data = model.createFeatures(rv, rj);
+        const Matrix& X = data.first;
+        const Vector& y = data.second;
+
+        const long W = static_cast<long>(window);
+        const long n_samples = X.rows();
+        if (W < 5 || n_samples <= W) return res;
+
+        // Sample j regresses rv[23 + j] on day 22 + j
+        res.first_day = 23 + window;
+        res.forecast.resize(n_samples - W);
+        res.realized.resize(n_samples - W);
+
+        Mat5 xtx;
+        Vec5 xty;
+        windowSums(X, y, 0, W, xtx, xty);
+
+        Vec5 theta = Vec5::Zero();
+        Scalar sq_err = 0.0;
+        Scalar qlike = 0.0;
+        long n_qlike = 0;
+
+        for (long k = W; k < n_samples; ++k) {
+            // Fit on samples [k - W, k)
+            Eigen::LLT<Mat5> llt(xtx);
+            if (llt.info() == Eigen::Success) {
+                theta = llt.solve(xty);
+            } else {
+                theta = X.middleRows(k - W, W).colPivHouseholderQr().solve(y.segment(k - W, W));
+            }
+
+            Vec5 x = X.row(k).transpose();
+            Scalar f = x.dot(theta);
+            Scalar realized = y(k);
+            res.forecast[k - W] = f;
+            res.realized[k - W] = realized;
+
+            Scalar err = realized - f;
+            sq_err += err * err;
+            if (f > 0.0 && realized > 0.0) {
+                Scalar ratio = realized / f;
+                qlike += ratio - std::log(ratio) - 1.0;
+                ++n_qlike;
+            }
+
+            // Slide: sample k enters, sample k - W leaves (re-anchored every W steps)
+            if ((k - W + 1) % W == 0) {
+                windowSums(X, y, k - W + 1, k + 1, xtx, xty);
+            } else {
+                Vec5 x_out = X.row(k - W).transpose();
+                xtx.noalias() += x * x.transpose() - x_out * x_out.transpose();
+                xty.noalias() += x * y(k) - x_out * y(k - W);
+            }
+        }
+
+        res.mse = sq_err / static_cast<Scalar>(n_samples - W);
+        res.qlike = (n_qlike > 0) ? qlike / static_cast<Scalar>(n_qlike) : 0.0;
+        return res;
+    }
+
+    std::vector<WalkForwardResult> HARWalkForward::run(const HARPanel& panel, const std::vector<size_t>& windows,
+                                                       ThreadPool& pool) {
+        const size_t n_windows = windows.size();
+        std::vector<WalkForwardResult> results(panel.n_symbols * n_windows);
+
+        // One task per (symbol, window); stealing balances uneven history lengths
+        pool.parallelFor(results.size(), 1, [&](size_t begin, size_t end, size_t) {
+            for (size_t job = begin; job < end; ++job) {
+                size_t s = job / n_windows;
+                size_t first = panel.offsets[s];
+                long len = static_cast<long>(panel.offsets[s + 1] - first);
+
+                Eigen::Map<const Vector> rv(panel.rv + first, len);
+                Eigen::Map<const Vector> rj(panel.rj + first, len);
+
+                results[job] = run(rv, rj, windows[job % n_windows]);
+                results[job].symbol = s;
+            }
+        });
+
+        return results;
+    }
+
+}
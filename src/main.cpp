@@ -5,10 +5,12 @@
 #include <cmath>
 #include "../include/adaptive_exec/VolatilityEstimators.hpp"
 #include "../include/adaptive_exec/HARModel.hpp"
+#include "../include/adaptive_exec/HARForecaster.hpp"
 #include "../include/adaptive_exec/HMMRegimeDetector.hpp"
 #include "../include/adaptive_exec/ExecutionEngine.hpp"
 #include "../include/adaptive_exec/RiskManager.hpp"
 #include "../include/adaptive_exec/HawkesModel.hpp"
+#include "../include/adaptive_exec/HawkesSimulator.hpp"
 #include "../include/adaptive_exec/backtest/BacktestEngine.hpp"
 #include "../include/adaptive_exec/analytics/ReportGenerator.hpp"
 
@@ -73,22 +75,13 @@ int simulateIntradaySession(int day, MarketRegime daily_regime) {
 
     HawkesModel hawkes(mu, alpha, beta);
 
-    std::mt19937 gen(day * 1234); 
-    std::exponential_distribution<> arrival_dist(mu); 
-    
-    double t = 0.0;
+    // Exact self-exciting arrivals for the day's regime
     double session_end = 100.0; 
-    int triggers = 0;
-    
-    while (t < session_end) {
-        double dt = arrival_dist(gen);
-        if (daily_regime == MarketRegime::HighVolatility && (int)t % 20 == 0) {
-            dt = 0.01; 
-        }
-
-        t += dt;
-        if (t > session_end) break;
+    std::vector<double> arrivals;
+    HawkesSimulator(mu, alpha, beta).simulate(session_end, static_cast<uint64_t>(day) * 1234, arrivals);
 
+    int triggers = 0;
+    for (double t : arrivals) {
         double intensity = hawkes.addEvent(t);
         if (ExecutionEngine::checkCircuitBreaker(intensity, threshold)) {
             triggers++;
@@ -157,6 +150,10 @@ int main() {
     har.fit(train_rv, train_rj);
     std::cout << "[Model] HAR Forecasting Model Fitted." << std::endl;
 
+    // Live forecaster, warmed up on the training window
+    HARForecaster vol_forecaster(har);
+    for (int i = 0; i < 50; ++i) vol_forecaster.update(tsrv[i], rj[i]);
+
     // 5. Initialize Backtest Engine
     BacktestEngine backtester(100000.0);
     std::cout << "[Backtest] Engine initialized with $100,000 capital." << std::endl;
@@ -175,9 +172,9 @@ int main() {
         int state_idx = states[i];
         MarketRegime regime = static_cast<MarketRegime>(state_idx);
 
-        Vector hist_rv = tsrv.head(i+1);
-        Vector hist_rj = rj.head(i+1);
-        // Scalar vol_forecast = har.predict(hist_rv, hist_rj); // Unused in this demo strategy logic
+        // O(1) next-day forecast from rolling sums (no per-day rescan of the history)
+        Scalar vol_forecast = vol_forecaster.update(tsrv[i], rj[i]);
+        (void)vol_forecast; // Unused in this demo strategy logic
 
         // Simple Trend Signal (SMA Crossover) for direction
         Scalar quantity = 0.0;
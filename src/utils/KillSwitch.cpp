@@ -0,0 +1,98 @@
+#include "../include/adaptive_exec/utils/KillSwitch.hpp"
+#include <chrono>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AdaptiveExec {
+
+    namespace {
+        int64_t steadyNowNs() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    }
+
+    KillSwitch::KillSwitch() : shared_(nullptr), state_(&local_) {
+        local_.word.store(0, std::memory_order_relaxed);
+        local_.trip_time_ns.store(0, std::memory_order_relaxed);
+    }
+
+    KillSwitch::~KillSwitch() {
+        detachShared();
+    }
+
+    KillSwitch& KillSwitch::global() {
+        static KillSwitch instance;
+        return instance;
+    }
+
+    bool KillSwitch::trip(TripReason reason) {
+        uint32_t bits = static_cast<uint32_t>(reason);
+        if (bits == 0) bits = static_cast<uint32_t>(TripReason::Manual);
+
+        uint32_t prev = state_->word.fetch_or(bits, std::memory_order_acq_rel);
+        if (prev != 0) return false;
+
+        // First tripper stamps the time (a racing reset() may clear it again, which is fine)
+        int64_t expected = 0;
+        state_->trip_time_ns.compare_exchange_strong(expected, steadyNowNs(), std::memory_order_release);
+        return true;
+    }
+
+    void KillSwitch::reset() {
+        state_->trip_time_ns.store(0, std::memory_order_relaxed);
+        state_->word.store(0, std::memory_order_release);
+    }
+
+    bool KillSwitch::attachShared(const std::string& name) {
+        detachShared();
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd < 0) return false;
+
+        // A freshly created segment is zero-filled, i.e. armed
+        if (ftruncate(fd, sizeof(State)) != 0) {
+            close(fd);
+            return false;
+        }
+        void* mem = mmap(nullptr, sizeof(State), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mem == MAP_FAILED) return false;
+
+        // Lock-free atomics are address-free, and zero bytes are a valid armed state
+        shared_ = static_cast<State*>(mem);
+
+        // Carry a local trip over so attaching can never un-halt this process
+        uint32_t local_bits = local_.word.load(std::memory_order_acquire);
+        if (local_bits != 0) {
+            shared_->word.fetch_or(local_bits, std::memory_order_acq_rel);
+            int64_t expected = 0;
+            shared_->trip_time_ns.compare_exchange_strong(
+                expected, local_.trip_time_ns.load(std::memory_order_relaxed), std::memory_order_release);
+        }
+
+        state_ = shared_;
+        return true;
+    }
+
+    void KillSwitch::detachShared() {
+        if (!shared_) return;
+
+        // Keep the halt locally if the host was halted
+        local_.word.fetch_or(shared_->word.load(std::memory_order_acquire), std::memory_order_acq_rel);
+        if (local_.trip_time_ns.load(std::memory_order_relaxed) == 0) {
+            local_.trip_time_ns.store(shared_->trip_time_ns.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        state_ = &local_;
+        munmap(shared_, sizeof(State));
+        shared_ = nullptr;
+    }
+
+    bool KillSwitch::unlinkShared(const std::string& name) {
+        return shm_unlink(name.c_str()) == 0;
+    }
+
+}
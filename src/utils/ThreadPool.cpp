@@ -0,0 +1,160 @@
+#include "../include/adaptive_exec/utils/ThreadPool.hpp"
+#include <algorithm>
+
+namespace AdaptiveExec {
+
+    namespace {
+        // Set while a thread executes a parallelFor body (nested calls run inline)
+        thread_local bool t_in_parallel_region = false;
+    }
+
+    ThreadPool::ThreadPool(size_t n_threads)
+        : n_workers_(n_threads), generation_(0), active_(0), stop_(false),
+          body_(nullptr), grain_(1) {
+        if (n_workers_ == 0) {
+            n_workers_ = std::max(1u, std::thread::hardware_concurrency());
+        }
+        queues_.reset(new WorkQueue[n_workers_]);
+
+        threads_.reserve(n_workers_ - 1);
+        for (size_t w = 1; w < n_workers_; ++w) {
+            threads_.emplace_back(&ThreadPool::workerLoop, this, w);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_start_.notify_all();
+        for (auto& t : threads_) t.join();
+    }
+
+    ThreadPool& ThreadPool::global() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    void ThreadPool::parallelFor(size_t n, size_t grain, const RangeFn& body) {
+        if (n == 0) return;
+        grain = std::max<size_t>(1, grain);
+
+        // Serial path: single worker, tiny range, or nested call
+        if (n_workers_ == 1 || n <= grain || t_in_parallel_region) {
+            bool outer = t_in_parallel_region;
+            t_in_parallel_region = true;
+            try {
+                for (size_t b = 0; b < n; b += grain) body(b, std::min(n, b + grain), 0);
+            } catch (...) {
+                t_in_parallel_region = outer;
+                throw;
+            }
+            t_in_parallel_region = outer;
+            return;
+        }
+
+        std::lock_guard<std::mutex> job_lock(job_mutex_);
+
+        // Even initial split, one contiguous range per worker
+        for (size_t w = 0; w < n_workers_; ++w) {
+            std::lock_guard<std::mutex> lock(queues_[w].mutex);
+            queues_[w].begin = n * w / n_workers_;
+            queues_[w].end = n * (w + 1) / n_workers_;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            body_ = &body;
+            grain_ = grain;
+            error_ = nullptr;
+            active_ = n_workers_ - 1;
+            ++generation_;
+        }
+        cv_start_.notify_all();
+
+        runWorker(0);
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_done_.wait(lock, [this] { return active_ == 0; });
+            body_ = nullptr;
+            error = error_;
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+    void ThreadPool::workerLoop(size_t worker) {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_start_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+
+            runWorker(worker);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --active_;
+                if (active_ == 0) cv_done_.notify_one();
+            }
+        }
+    }
+
+    void ThreadPool::runWorker(size_t worker) {
+        t_in_parallel_region = true;
+        size_t begin = 0, end = 0;
+        while (true) {
+            if (popLocal(worker, begin, end)) {
+                try {
+                    (*body_)(begin, end, worker);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!error_) error_ = std::current_exception();
+                }
+            } else if (!steal(worker)) {
+                break;
+            }
+        }
+        t_in_parallel_region = false;
+    }
+
+    bool ThreadPool::popLocal(size_t worker, size_t& begin, size_t& end) {
+        WorkQueue& q = queues_[worker];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.begin >= q.end) return false;
+        begin = q.begin;
+        end = std::min(q.end, q.begin + grain_);
+        q.begin = end;
+        return true;
+    }
+
+    bool ThreadPool::steal(size_t thief) {
+        for (size_t k = 1; k < n_workers_; ++k) {
+            size_t victim = (thief + k) % n_workers_;
+            size_t begin = 0, end = 0;
+            {
+                WorkQueue& q = queues_[victim];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                size_t remaining = q.end - q.begin;
+                if (remaining == 0) continue;
+                // Take the back half (or everything if only one chunk is left)
+                size_t take = (remaining > grain_) ? remaining / 2 : remaining;
+                end = q.end;
+                begin = q.end - take;
+                q.end = begin;
+            }
+            WorkQueue& own = queues_[thief];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = begin;
+            own.end = end;
+            return true;
+        }
+        return false;
+    }
+
+}
@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include "../include/adaptive_exec/AlmgrenChrissSolver.hpp"
+#include "../include/adaptive_exec/ExecutionEngine.hpp"
+#include "../include/adaptive_exec/ExecutionScheduler.hpp"
+#include "../include/adaptive_exec/utils/KillSwitch.hpp"
+#include <map>
+#include <random>
+#include <cmath>
+#include <vector>
+
+using namespace AdaptiveExec;
+
+TEST(ExecutionTest, AlmgrenChrissMatchesClosedFormAndIsOptimal) {
+    AlmgrenChrissSolver solver({10});
+    const int N = 10;
+    const Scalar X = 5000.0;
+
+    for (MarketRegime regime : {MarketRegime::LowVolatility, MarketRegime::Normal, MarketRegime::HighVolatility}) {
+        // sinh trajectory computed directly
+        Scalar kappa = solver.kappa(regime);
+        std::vector<Scalar> hold(N + 1);
+        ASSERT_TRUE(solver.holdings(regime, X, N, hold.data()));
+        for (int j = 0; j <= N; ++j) {
+            Scalar expected = X * std::sinh(kappa * (N - j)) / std::sinh(kappa * N);
+            EXPECT_NEAR(hold[j], expected, 1e-9 * X);
+        }
+
+        // Cached (N = 10) and closed-form (N = 11 -> uncached) paths, both summing to X
+        Vector cached = solver.schedule(regime, X, N);
+        EXPECT_NEAR(cached.sum(), X, 1e-9 * X);
+        Vector uncached = solver.schedule(regime, X, N + 1);
+        EXPECT_NEAR(uncached.sum(), X, 1e-9 * X);
+
+        // Any zero-sum perturbation raises E + lambda Var
+        const Scalar lambda = solver.getParameters(regime).risk_aversion;
+        ScheduleCost base = solver.evaluate(regime, cached.data(), N);
+        Scalar objective = base.expected + lambda * base.variance;
+        for (int a = 0; a < N; ++a) {
+            for (int b = 0; b < N; ++b) {
+                if (a == b) continue;
+                Vector moved = cached;
+                moved(a) += 1.0;
+                moved(b) -= 1.0;
+                ScheduleCost c = solver.evaluate(regime, moved.data(), N);
+                EXPECT_GT(c.expected + lambda * c.variance, objective);
+            }
+        }
+    }
+
+    // More volatility -> more front-loaded
+    EXPECT_LT(solver.kappa(MarketRegime::LowVolatility), solver.kappa(MarketRegime::HighVolatility));
+    Vector low = solver.schedule(MarketRegime::LowVolatility, X, N);
+    Vector high = solver.schedule(MarketRegime::HighVolatility, X, N);
+    EXPECT_GT(high(0), low(0));
+    EXPECT_LT(high(N - 1), low(N - 1));
+}
+
+TEST(ExecutionTest, AlmgrenChrissDegenerateCasesAndCache) {
+    AlmgrenChrissSolver solver;
+
+    // No risk aversion: TWAP
+    solver.setParameters(MarketRegime::Normal, {0.01, 0.05, 0.025, 0.0});
+    Vector twap = solver.schedule(MarketRegime::Normal, 1200.0, 12);
+    for (int j = 0; j < 12; ++j) EXPECT_NEAR(twap(j), 100.0, 1e-9);
+
+    // Very large kappa N does not overflow: everything in the first period
+    solver.setParameters(MarketRegime::HighVolatility, {10.0, 0.01, 0.0, 100.0});
+    Vector urgent = solver.schedule(MarketRegime::HighVolatility, -300.0, 390);
+    EXPECT_TRUE(urgent.allFinite());
+    EXPECT_NEAR(urgent(0), -300.0, 1e-2);
+    EXPECT_NEAR(urgent.sum(), -300.0, 1e-9);
+
+    // Cached horizon (390) equals the closed form computed on the fly
+    AlmgrenChrissSolver uncached(std::vector<int>{});
+    std::vector<Scalar> a(390), b(390);
+    ASSERT_TRUE(AlmgrenChrissSolver().schedule(MarketRegime::Normal, 1e6, 390, a.data()));
+    ASSERT_TRUE(uncached.schedule(MarketRegime::Normal, 1e6, 390, b.data()));
+    for (int j = 0; j < 390; ++j) EXPECT_DOUBLE_EQ(a[j], b[j]);
+
+    EXPECT_TRUE(ExecutionEngine::getOptimalSchedule(MarketRegime::Normal, 1e6, 390, b.data()));
+    for (int j = 0; j < 390; ++j) EXPECT_DOUBLE_EQ(a[j], b[j]);
+    EXPECT_FALSE(solver.schedule(MarketRegime::Normal, 1.0, 0, b.data()));
+}
+
+TEST(ExecutionTest, SchedulerReleasesAlmgrenChrissSlicesOnTime) {
+    AlmgrenChrissSolver solver;
+    ExecutionScheduler scheduler(100, MarketRegime::Normal, solver);
+
+    uint64_t id = scheduler.submit(10000.0, 10, 5, 103);
+    EXPECT_EQ(scheduler.liveOrders(), 1u);
+
+    // First four slices under Normal: ticks 103, 108, 113, 118
+    std::vector<ChildOrder> out;
+    EXPECT_EQ(scheduler.advance(120, out), 4u);
+    Vector plan = solver.schedule(MarketRegime::Normal, 10000.0, 10);
+    for (int k = 0; k < 4; ++k) {
+        EXPECT_EQ(out[k].parent_id, id);
+        EXPECT_EQ(out[k].release_tick, 103u + 5u * k);
+        EXPECT_NEAR(out[k].quantity, plan(k), 1e-9);
+        EXPECT_EQ(out[k].periods_left, 9 - k);
+    }
+
+    // Regime flips mid-order: the rest follows the high-vol plan for the remaining quantity
+    Scalar left = scheduler.remaining(id);
+    EXPECT_NEAR(left, plan.tail(6).sum(), 1e-9);
+    scheduler.setRegime(MarketRegime::HighVolatility);
+    out.clear();
+    EXPECT_EQ(scheduler.advance(1000, out), 6u);
+    Vector replan = solver.schedule(MarketRegime::HighVolatility, left, 6);
+    Scalar executed = 0.0;
+    for (int k = 0; k < 6; ++k) {
+        EXPECT_NEAR(out[k].quantity, replan(k), 1e-9);
+        EXPECT_EQ(out[k].regime, MarketRegime::HighVolatility);
+        executed += out[k].quantity;
+    }
+    EXPECT_NEAR(executed, left, 1e-9);
+    EXPECT_EQ(out.back().periods_left, 0);
+    EXPECT_EQ(scheduler.liveOrders(), 0u);
+    EXPECT_FALSE(scheduler.cancel(id));
+
+    // Cancel stops further slices; the id is not reused
+    uint64_t cancelled = scheduler.submit(500.0, 3, 10, 0);
+    EXPECT_TRUE(scheduler.cancel(cancelled));
+    uint64_t reused = scheduler.submit(500.0, 3, 10, 0);
+    EXPECT_NE(reused, cancelled);
+    EXPECT_DOUBLE_EQ(scheduler.remaining(cancelled), 0.0);
+    out.clear();
+    scheduler.advance(2000, out);
+    ASSERT_EQ(out.size(), 3u);
+    for (const ChildOrder& c : out) EXPECT_EQ(c.parent_id, reused);
+    EXPECT_EQ(out[0].release_tick, 1001u);
+}
+
+TEST(ExecutionTest, SchedulerTimerWheelMatchesBruteForceAcrossLevels) {
+    std::mt19937_64 gen(13);
+    std::uniform_int_distribution<uint64_t> interval_dist(1, 300000);
+    std::uniform_int_distribution<uint64_t> start_dist(0, 20000000);
+    std::uniform_int_distribution<int> periods_dist(1, 6);
+
+    ExecutionScheduler scheduler(0);
+    std::map<uint64_t, std::vector<uint64_t>> expected; // parent -> release ticks
+    for (int p = 0; p < 2000; ++p) {
+        uint64_t interval = (p % 50 == 0) ? (uint64_t(1) << 33) : interval_dist(gen); // some beyond the wheel span
+        uint64_t start = start_dist(gen);
+        int periods = periods_dist(gen);
+        uint64_t id = scheduler.submit(100.0, periods, interval, start);
+        for (int k = 0; k < periods; ++k) expected[id].push_back(std::max<uint64_t>(start, 1) + interval * k);
+    }
+
+    // Uneven steps, including very long jumps
+    std::map<uint64_t, std::vector<uint64_t>> released;
+    std::vector<ChildOrder> out;
+    uint64_t t = 0;
+    std::uniform_int_distribution<uint64_t> step_dist(1, 5000);
+    while (scheduler.liveOrders() > 0) {
+        t += (t > 30000000) ? (uint64_t(1) << 30) : step_dist(gen);
+        out.clear();
+        scheduler.advance(t, out);
+        uint64_t prev_tick = 0;
+        for (const ChildOrder& c : out) {
+            EXPECT_LE(c.release_tick, t);
+            EXPECT_GE(c.release_tick, prev_tick);
+            prev_tick = c.release_tick;
+            released[c.parent_id].push_back(c.release_tick);
+        }
+    }
+    EXPECT_EQ(released, expected);
+}
+
+TEST(ExecutionTest, SchedulerSkipsEmptyStretchesOnHigherLevels) {
+    // Only far timers live: one per level 1-3 and one beyond the wheel span, a single advance
+    ExecutionScheduler scheduler(7);
+    std::vector<uint64_t> due = {7 + 300, 7 + 70000, 7 + (uint64_t(1) << 26), (uint64_t(1) << 33) + 5};
+    std::vector<uint64_t> ids;
+    for (uint64_t t : due) ids.push_back(scheduler.submit(10.0, 1, 1, t));
+
+    std::vector<ChildOrder> out;
+    EXPECT_EQ(scheduler.advance(due.back() - 1, out), 3u);
+    EXPECT_EQ(scheduler.advance(due.back(), out), 1u);
+    ASSERT_EQ(out.size(), due.size());
+    for (size_t k = 0; k < due.size(); ++k) {
+        EXPECT_EQ(out[k].parent_id, ids[k]);
+        EXPECT_EQ(out[k].release_tick, due[k]);
+    }
+    EXPECT_EQ(scheduler.now(), due.back());
+}
+
+TEST(ExecutionTest, SchedulerHoldsSlicesWhileKillSwitchTripped) {
+    KillSwitch& halt = KillSwitch::global();
+    halt.reset();
+
+    AlmgrenChrissSolver solver;
+    ExecutionScheduler scheduler(0, MarketRegime::Normal, solver);
+    uint64_t id = scheduler.submit(1000.0, 4, 10, 10);
+
+    std::vector<ChildOrder> out;
+    EXPECT_EQ(scheduler.advance(10, out), 1u);
+    Scalar left = scheduler.remaining(id);
+
+    // Halted: due slices at 20, 30, 40 are held, nothing executes
+    halt.trip(TripReason::Manual);
+    out.clear();
+    EXPECT_EQ(scheduler.advance(45, out), 0u);
+    EXPECT_DOUBLE_EQ(scheduler.remaining(id), left);
+    EXPECT_EQ(scheduler.liveOrders(), 1u);
+
+    // Resumed: the held parent continues one interval after its last hold with all 3 periods
+    halt.reset();
+    out.clear();
+    EXPECT_EQ(scheduler.advance(1000, out), 3u);
+    Vector replan = solver.schedule(MarketRegime::Normal, left, 3);
+    for (int k = 0; k < 3; ++k) {
+        EXPECT_EQ(out[k].release_tick, 50u + 10u * k);
+        EXPECT_NEAR(out[k].quantity, replan(k), 1e-9);
+    }
+    EXPECT_EQ(scheduler.liveOrders(), 0u);
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include "../include/adaptive_exec/HARModel.hpp"
+#include "../include/adaptive_exec/HARForecaster.hpp"
+#include "../include/adaptive_exec/HAROnlineFitter.hpp"
+#include "../include/adaptive_exec/backtest/HARWalkForward.hpp"
+#include <random>
+#include <cmath>
+
+using namespace AdaptiveExec;
+
+namespace {
+
+    // Persistent positive daily RV with occasional jump days
+    void sampleHARSeries(long n, unsigned seed, Vector& rv, Vector& rj) {
+        std::mt19937 gen(seed);
+        std::normal_distribution<> z(0.0, 1.0);
+        std::uniform_real_distribution<> u(0.0, 1.0);
+        rv.resize(n);
+        rj.resize(n);
+        Scalar log_rv = std::log(1e-4);
+        for (long t = 0; t < n; ++t) {
+            log_rv = 0.95 * log_rv + 0.05 * std::log(1e-4) + 0.3 * z(gen);
+            rj(t) = (u(gen) < 0.1) ? std::exp(log_rv) * u(gen) : 0.0;
+            rv(t) = std::exp(log_rv) + rj(t);
+        }
+    }
+
+}
+
+TEST(HARTest, ForecasterMatchesBatchPredict) {
+    Vector rv, rj;
+    sampleHARSeries(400, 3, rv, rj);
+
+    HARModel har;
+    Scalar r2 = har.fit(rv.head(200), rj.head(200));
+    EXPECT_GT(r2, 0.0);
+
+    HARForecaster forecaster(har);
+    for (long t = 0; t < rv.size(); ++t) {
+        Scalar live = forecaster.update(rv(t), rj(t));
+        Scalar batch = har.predict(rv.head(t + 1), rj.head(t + 1));
+        if (t + 1 < 23) {
+            EXPECT_FALSE(forecaster.isReady());
+            EXPECT_EQ(live, 0.0);
+            EXPECT_EQ(batch, 0.0);
+        } else {
+            EXPECT_NEAR(live, batch, 1e-12 * std::abs(batch));
+        }
+    }
+    EXPECT_EQ(forecaster.count(), static_cast<size_t>(rv.size()));
+
+    // New coefficients apply to the kept history
+    HARModel refit;
+    refit.fit(rv, rj);
+    forecaster.setCoefficients(refit.getCoefficients());
+    EXPECT_NEAR(forecaster.forecast(), refit.predict(rv, rj), 1e-12 * std::abs(refit.predict(rv, rj)));
+
+    forecaster.reset();
+    EXPECT_EQ(forecaster.count(), 0u);
+    EXPECT_EQ(forecaster.forecast(), 0.0);
+
+    // Unfitted model: no forecast
+    HARForecaster unfitted{HARModel()};
+    for (long t = 0; t < 30; ++t) EXPECT_EQ(unfitted.update(rv(t), rj(t)), 0.0);
+}
+
+TEST(HARTest, OnlineFitMatchesBatchFit) {
+    Vector rv, rj;
+    sampleHARSeries(600, 5, rv, rj);
+
+    auto expectCoefficientsNear = [](const Vector& a, const Vector& b) {
+        ASSERT_EQ(a.size(), 5);
+        ASSERT_EQ(b.size(), 5);
+        for (int i = 0; i < 5; ++i) EXPECT_NEAR(a(i), b(i), 1e-6 * (std::abs(b(i)) + 1e-4));
+    };
+
+    // Expanding window: one RLS update per day vs a QR refit on the full history
+    HAROnlineFitter expanding;
+    HARModel batch;
+    for (long t = 0; t < rv.size(); ++t) {
+        expanding.update(rv(t), rj(t));
+        if (t == 100 || t == 350 || t + 1 == rv.size()) {
+            Scalar r2 = batch.fit(rv.head(t + 1), rj.head(t + 1));
+            ASSERT_TRUE(expanding.isFitted());
+            EXPECT_EQ(expanding.sampleCount(), static_cast<size_t>(t + 1 - 23));
+            expectCoefficientsNear(expanding.getCoefficients(), batch.getCoefficients());
+            EXPECT_NEAR(expanding.rSquared(), r2, 1e-8);
+            EXPECT_NEAR(expanding.forecast(), batch.predict(rv.head(t + 1), rj.head(t + 1)), 1e-6 * rv.mean());
+        }
+    }
+
+    // Sliding window of W samples: add/remove vs a refit on the last W samples
+    // (W samples need W + 23 days of history)
+    const size_t W = 120;
+    HAROnlineFitter sliding(1.0, W);
+    sliding.fit(rv, rj);
+    EXPECT_EQ(sliding.sampleCount(), W);
+    long days = static_cast<long>(W) + 23;
+    Scalar r2_window = batch.fit(rv.tail(days), rj.tail(days));
+    expectCoefficientsNear(sliding.getCoefficients(), batch.getCoefficients());
+    EXPECT_NEAR(sliding.rSquared(), r2_window, 1e-8);
+
+    // Exponential forgetting vs weighted least squares solved directly
+    const Scalar lambda = 0.98;
+    HAROnlineFitter forgetting(lambda);
+    forgetting.fit(rv, rj);
+    Matrix Xw(rv.size() - 23, 5);
+    Vector yw(rv.size() - 23);
+    for (long c = 22; c + 1 < rv.size(); ++c) {
+        long i = c - 22;
+        Scalar w = std::sqrt(std::pow(lambda, static_cast<Scalar>(rv.size() - 2 - c)));
+        Xw.row(i) << 1.0, rv(c), rv.segment(c - 5, 5).mean(), rv.segment(c - 22, 22).mean(), rj(c);
+        Xw.row(i) *= w;
+        yw(i) = w * rv(c + 1);
+    }
+    Vector weighted = Xw.colPivHouseholderQr().solve(yw);
+    expectCoefficientsNear(forgetting.getCoefficients(), weighted);
+
+    forgetting.reset();
+    EXPECT_FALSE(forgetting.isFitted());
+    EXPECT_EQ(forgetting.forecast(), 0.0);
+}
+
+TEST(HARTest, WalkForwardMatchesRollingRefits) {
+    // Three symbols with uneven histories, stored columnar
+    std::vector<long> lengths = {260, 150, 40};
+    std::vector<Scalar> rv_data, rj_data;
+    std::vector<size_t> offsets = {0};
+    std::vector<Vector> rv_series, rj_series;
+    for (size_t s = 0; s < lengths.size(); ++s) {
+        Vector rv, rj;
+        sampleHARSeries(lengths[s], 20 + s, rv, rj);
+        rv_data.insert(rv_data.end(), rv.data(), rv.data() + rv.size());
+        rj_data.insert(rj_data.end(), rj.data(), rj.data() + rj.size());
+        offsets.push_back(rv_data.size());
+        rv_series.push_back(rv);
+        rj_series.push_back(rj);
+    }
+    HARPanel panel{rv_data.data(), rj_data.data(), offsets.data(), lengths.size()};
+
+    std::vector<size_t> windows = {30, 90};
+    ThreadPool pool(3);
+    std::vector<WalkForwardResult> results = HARWalkForward::run(panel, windows, pool);
+    ASSERT_EQ(results.size(), lengths.size() * windows.size());
+
+    for (size_t s = 0; s < lengths.size(); ++s) {
+        const Vector& rv = rv_series[s];
+        const Vector& rj = rj_series[s];
+        for (size_t w = 0; w < windows.size(); ++w) {
+            const WalkForwardResult& res = results[s * windows.size() + w];
+            const long W = static_cast<long>(windows[w]);
+            EXPECT_EQ(res.symbol, s);
+            EXPECT_EQ(res.window, windows[w]);
+
+            long n_samples = rv.size() - 23;
+            if (n_samples <= W) {
+                EXPECT_TRUE(res.forecast.empty());
+                continue;
+            }
+            ASSERT_EQ(res.forecast.size(), static_cast<size_t>(n_samples - W));
+            EXPECT_EQ(res.first_day, static_cast<size_t>(23 + W));
+
+            // Reference: QR refit on the W samples before each forecast day
+            Scalar mse = 0.0;
+            for (long k = W; k < n_samples; ++k) {
+                HARModel model;
+                model.fit(rv.segment(k - W, W + 23), rj.segment(k - W, W + 23));
+                Scalar expected = model.predict(rv.head(23 + k), rj.head(23 + k));
+                EXPECT_NEAR(res.forecast[k - W], expected, 1e-6 * rv.mean());
+                EXPECT_EQ(res.realized[k - W], rv(23 + k));
+                mse += (rv(23 + k) - res.forecast[k - W]) * (rv(23 + k) - res.forecast[k - W]);
+            }
+            EXPECT_NEAR(res.mse, mse / (n_samples - W), 1e-12 * mse);
+            EXPECT_GE(res.qlike, 0.0);
+        }
+    }
+}
+
+TEST(HARTest, BatchMultiHorizonMatchesIteratedPredict) {
+    std::vector<long> lengths = {300, 23, 10, 120};
+    std::vector<Scalar> rv_data, rj_data;
+    std::vector<size_t> offsets = {0};
+    std::vector<Vector> rv_series, rj_series;
+    Matrix coefficients = Matrix::Zero(lengths.size(), 5);
+    for (size_t s = 0; s < lengths.size(); ++s) {
+        Vector rv, rj;
+        sampleHARSeries(lengths[s], 40 + s, rv, rj);
+        rv_data.insert(rv_data.end(), rv.data(), rv.data() + rv.size());
+        rj_data.insert(rj_data.end(), rj.data(), rj.data() + rj.size());
+        offsets.push_back(rv_data.size());
+        rv_series.push_back(rv);
+        rj_series.push_back(rj);
+
+        // Per-symbol coefficients (the 23-day symbol has no samples and keeps zeros)
+        HARModel model;
+        model.fit(rv, rj);
+        coefficients.row(s) = model.getCoefficients().transpose();
+    }
+    HARPanel panel{rv_data.data(), rj_data.data(), offsets.data(), lengths.size()};
+
+    std::vector<int> horizons = {1, 5, 22};
+    Matrix forecasts = HARModel::forecastBatch(panel, coefficients, horizons);
+    ASSERT_EQ(forecasts.rows(), static_cast<long>(lengths.size()));
+    ASSERT_EQ(forecasts.cols(), 3);
+
+    for (size_t s = 0; s < lengths.size(); ++s) {
+        HARModel model;
+        model.fit(rv_series[s], rj_series[s]);
+        if (lengths[s] < 23) {
+            EXPECT_EQ(forecasts.row(s).cwiseAbs().maxCoeff(), 0.0);
+            continue;
+        }
+
+        // Reference: append each forecast to the history and predict again,
+        // with future jumps at the trailing 22-day mean
+        Vector rv = rv_series[s];
+        Vector rj = rj_series[s];
+        Scalar rj_future = rj.tail(22).mean();
+        Vector path(22);
+        for (int h = 1; h <= 22; ++h) {
+            Scalar f = model.predict(rv, rj);
+            path(h - 1) = f;
+            rv.conservativeResize(rv.size() + 1);
+            rj.conservativeResize(rj.size() + 1);
+            rv(rv.size() - 1) = f;
+            rj(rj.size() - 1) = rj_future;
+        }
+        for (size_t k = 0; k < horizons.size(); ++k) {
+            Scalar expected = path(horizons[k] - 1);
+            EXPECT_NEAR(forecasts(s, k), expected, 1e-12 * std::abs(expected)) << "symbol " << s << " h " << horizons[k];
+        }
+    }
+}
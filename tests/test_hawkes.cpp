@@ -0,0 +1,323 @@
+#include <gtest/gtest.h>
+#include "../include/adaptive_exec/HawkesModel.hpp"
+#include "../include/adaptive_exec/HawkesCalibration.hpp"
+#include "../include/adaptive_exec/MultivariateHawkesModel.hpp"
+#include "../include/adaptive_exec/HawkesSimulator.hpp"
+#include "../include/adaptive_exec/ConcurrentHawkesModel.hpp"
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <thread>
+
+using namespace AdaptiveExec;
+
+namespace {
+
+    // Ogata thinning on [0, T]
+    std::vector<double> simulateHawkes(double mu, double alpha, double beta, double T, unsigned seed) {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<> u(0.0, 1.0);
+        std::vector<double> times;
+        double t = 0.0;
+        double excite = 0.0; // sum alpha e^{-beta (t - t_i)} at time t
+        while (true) {
+            double bound = mu + excite;
+            double w = -std::log(1.0 - u(gen)) / bound;
+            excite *= std::exp(-beta * w);
+            t += w;
+            if (t > T) break;
+            if (u(gen) * bound <= mu + excite) {
+                times.push_back(t);
+                excite += alpha;
+            }
+        }
+        return times;
+    }
+
+}
+
+TEST(HawkesTest, LikelihoodGradientMatchesFiniteDifferences) {
+    const double T = 2000.0;
+    std::vector<double> times = simulateHawkes(0.5, 0.8, 2.0, T, 7);
+    ASSERT_GT(times.size(), 100u);
+
+    // Brute-force O(N^2) likelihood at the same point
+    const double mu = 0.6, alpha = 0.7, beta = 1.7;
+    double brute = -mu * T;
+    for (size_t i = 0; i < times.size(); ++i) {
+        double lam = mu;
+        for (size_t j = 0; j < i; ++j) lam += alpha * std::exp(-beta * (times[i] - times[j]));
+        brute += std::log(lam) - (alpha / beta) * (1.0 - std::exp(-beta * (T - times[i])));
+    }
+
+    double grad[3];
+    double ll = HawkesCalibrator::logLikelihood(times, T, mu, alpha, beta, grad);
+    EXPECT_NEAR(ll, brute, 1e-8 * std::abs(brute));
+
+    const double params[3] = {mu, alpha, beta};
+    for (int k = 0; k < 3; ++k) {
+        double up[3] = {params[0], params[1], params[2]};
+        double dn[3] = {params[0], params[1], params[2]};
+        double h = 1e-6 * params[k];
+        up[k] += h;
+        dn[k] -= h;
+        double fd = (HawkesCalibrator::logLikelihood(times, T, up[0], up[1], up[2]) -
+                     HawkesCalibrator::logLikelihood(times, T, dn[0], dn[1], dn[2])) / (2.0 * h);
+        EXPECT_NEAR(grad[k], fd, 1e-5 * std::max(1.0, std::abs(fd)));
+    }
+}
+
+TEST(HawkesTest, CalibrationRecoversSimulatedParameters) {
+    const double mu = 1.0, alpha = 3.0, beta = 5.0, T = 20000.0;
+    std::vector<double> times = simulateHawkes(mu, alpha, beta, T, 11);
+
+    HawkesFitResult fit = HawkesCalibrator::fit(times, T);
+    EXPECT_TRUE(fit.converged);
+    EXPECT_NEAR(fit.mu, mu, 0.1 * mu);
+    EXPECT_NEAR(fit.alpha, alpha, 0.1 * alpha);
+    EXPECT_NEAR(fit.beta, beta, 0.1 * beta);
+    EXPECT_LT(fit.alpha / fit.beta, 1.0);
+
+    // The optimum beats the true parameters (up to optimizer tolerance)
+    EXPECT_GE(fit.log_likelihood, HawkesCalibrator::logLikelihood(times, T, mu, alpha, beta) - 1e-6);
+
+    HawkesModel model = fit.model();
+    EXPECT_DOUBLE_EQ(model.getBeta(), fit.beta);
+
+    // Too few events: nothing to fit
+    std::vector<double> one = {1.0};
+    EXPECT_FALSE(std::isfinite(HawkesCalibrator::fit(one, T).log_likelihood));
+}
+
+TEST(HawkesTest, MultivariateMatchesBruteForceIntensity) {
+    const int D = 3;
+    Vector mu(D);
+    mu << 0.5, 0.3, 0.2;
+    Matrix alpha(D, D);
+    alpha << 0.4, 0.1, 0.0,
+             0.3, 0.5, 0.1,
+             0.0, 0.2, 0.6;
+    Vector beta(D);
+    beta << 1.0, 2.0, 1.5;
+
+    MultivariateHawkesModel model(mu, alpha, beta);
+    EXPECT_LT(model.branchingRatio(), 1.0);
+
+    std::mt19937 gen(3);
+    std::exponential_distribution<> gap(2.0);
+    std::uniform_int_distribution<> pick(0, D - 1);
+    std::vector<double> times;
+    std::vector<int> dims;
+    double t = 0.0;
+    for (int k = 0; k < 300; ++k) {
+        t += gap(gen);
+        times.push_back(t);
+        dims.push_back(pick(gen));
+    }
+    model.addEvents(times.data(), dims.data(), times.size());
+
+    const double query = t + 0.25;
+    Vector lam;
+    model.getIntensity(query, lam);
+    for (int i = 0; i < D; ++i) {
+        double brute = mu(i);
+        for (size_t k = 0; k < times.size(); ++k) {
+            brute += alpha(i, dims[k]) * std::exp(-beta(i) * (query - times[k]));
+        }
+        EXPECT_NEAR(lam(i), brute, 1e-12);
+        EXPECT_NEAR(model.getIntensity(query, i), brute, 1e-12);
+    }
+    EXPECT_NEAR(model.getTotalIntensity(query), lam.sum(), 1e-12);
+    EXPECT_EQ(model.isCritical(query, lam.maxCoeff() - 1e-9), true);
+    EXPECT_EQ(model.isCritical(query, lam.maxCoeff() + 1e-9), false);
+
+    model.reset();
+    model.getIntensity(0.0, lam);
+    EXPECT_TRUE(lam.isApprox(mu));
+}
+
+TEST(HawkesTest, MultivariateConstQueriesAreSafeAcrossThreads) {
+    const int D = 4;
+    Vector mu = Vector::Constant(D, 0.4);
+    Matrix alpha = Matrix::Constant(D, D, 0.1);
+    alpha.diagonal().setConstant(0.5);
+    Vector mixed(D), shared(D);
+    mixed << 1.0, 2.0, 1.5, 3.0;
+    shared.setConstant(2.0);
+
+    // Both decay paths: one exp per dimension and the shared (uniform) decay
+    for (const Vector& beta : {mixed, shared}) {
+        MultivariateHawkesModel model(mu, alpha, beta);
+        double t = 0.0;
+        for (int k = 0; k < 200; ++k) {
+            t += 0.05 + 0.01 * (k % 5);
+            model.addEvent(t, k % D);
+        }
+
+        // Single-threaded answers at a grid of query times
+        const int Q = 64;
+        std::vector<double> total(Q);
+        std::vector<bool> critical(Q), critical_each(Q);
+        Vector thresholds = Vector::LinSpaced(D, 1.0, 2.5);
+        Vector lam;
+        for (int q = 0; q < Q; ++q) {
+            double query = t + 0.02 * q;
+            model.getIntensity(query, lam);
+            total[q] = model.getTotalIntensity(query);
+            critical[q] = model.isCritical(query, 1.5);
+            critical_each[q] = model.isCritical(query, thresholds);
+            EXPECT_NEAR(total[q], lam.sum(), 1e-12);
+            EXPECT_EQ(critical[q], (lam.array() > 1.5).any());
+            EXPECT_EQ(critical_each[q], (lam.array() > thresholds.array()).any());
+        }
+
+        std::atomic<size_t> mismatches(0);
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 4; ++r) {
+            readers.emplace_back([&, r]() {
+                size_t local = 0;
+                for (int rep = 0; rep < 2000; ++rep) {
+                    int q = (rep + 17 * r) % Q;
+                    double query = t + 0.02 * q;
+                    if (model.getTotalIntensity(query) != total[q]) ++local;
+                    if (model.isCritical(query, 1.5) != critical[q]) ++local;
+                    if (model.isCritical(query, thresholds) != critical_each[q]) ++local;
+                }
+                mismatches += local;
+            });
+        }
+        for (auto& th : readers) th.join();
+        EXPECT_EQ(mismatches.load(), 0u);
+    }
+}
+
+TEST(HawkesTest, OneDimensionalMatchesUnivariateModel) {
+    Vector mu(1), beta(1);
+    Matrix alpha(1, 1);
+    mu << 0.5;
+    alpha << 0.8;
+    beta << 1.3;
+    MultivariateHawkesModel multi(mu, alpha, beta);
+    HawkesModel uni(0.5, 0.8, 1.3);
+
+    double t = 0.0;
+    for (int k = 0; k < 100; ++k) {
+        t += 0.1 + 0.05 * (k % 7);
+        EXPECT_NEAR(multi.addEvent(t, 0), uni.addEvent(t), 1e-12);
+        EXPECT_NEAR(multi.getIntensity(t + 0.3, 0), uni.getIntensity(t + 0.3), 1e-12);
+    }
+    EXPECT_NEAR(multi.branchingRatio(), 0.8 / 1.3, 1e-12);
+    EXPECT_DOUBLE_EQ(multi.addEvent(t, 1), 0.0);
+}
+
+TEST(HawkesTest, SimulatorIsDeterministicAndMatchesModel) {
+    const double mu = 2.0, alpha = 0.8, beta = 1.0, T = 100.0, limit = 5.0;
+    HawkesSimulator simulator(mu, alpha, beta);
+
+    // Session statistics are the HawkesModel / circuit-breaker replay of the same stream
+    std::vector<double> times;
+    simulator.simulate(T, HawkesSimulator::streamSeed(7, 3), times);
+    ASSERT_FALSE(times.empty());
+    EXPECT_TRUE(std::is_sorted(times.begin(), times.end()));
+    EXPECT_LE(times.back(), T);
+
+    HawkesModel model(mu, alpha, beta);
+    size_t triggers = 0;
+    double max_intensity = mu;
+    for (double t : times) {
+        double intensity = model.addEvent(t);
+        max_intensity = std::max(max_intensity, intensity);
+        if (intensity > limit) ++triggers;
+    }
+
+    ThreadPool serial(1), parallel(4);
+    std::vector<HawkesSessionStats> a = simulator.simulateSessions(64, T, limit, 7, serial);
+    std::vector<HawkesSessionStats> b = simulator.simulateSessions(64, T, limit, 7, parallel);
+    ASSERT_EQ(a.size(), 64u);
+    EXPECT_EQ(a[3].n_events, times.size());
+    EXPECT_EQ(a[3].n_triggers, triggers);
+    EXPECT_NEAR(a[3].max_intensity, max_intensity, 1e-12);
+    for (size_t s = 0; s < a.size(); ++s) {
+        EXPECT_EQ(a[s].n_events, b[s].n_events);
+        EXPECT_EQ(a[s].n_triggers, b[s].n_triggers);
+        EXPECT_EQ(a[s].first_trigger, b[s].first_trigger);
+    }
+}
+
+TEST(HawkesTest, SimulatorMatchesStationaryMoments) {
+    // E[N(T)] ~= mu T / (1 - alpha / beta) for T >> 1 / beta
+    const double mu = 1.0, alpha = 0.5, beta = 1.0, T = 1000.0;
+    HawkesSimulator simulator(mu, alpha, beta);
+    std::vector<HawkesSessionStats> stats = simulator.simulateSessions(400, T, 1e9, 11);
+
+    double mean = 0.0;
+    for (const HawkesSessionStats& s : stats) {
+        mean += static_cast<double>(s.n_events);
+        EXPECT_EQ(s.n_triggers, 0u);
+        EXPECT_EQ(s.first_trigger, -1.0);
+    }
+    mean /= static_cast<double>(stats.size());
+    EXPECT_NEAR(mean, mu * T / (1.0 - alpha / beta), 0.02 * mu * T / (1.0 - alpha / beta));
+
+    // And the calibrator recovers the simulator's parameters
+    std::vector<double> times;
+    HawkesSimulator(1.0, 3.0, 5.0).simulate(20000.0, 5, times);
+    HawkesFitResult fit = HawkesCalibrator::fit(times, 20000.0);
+    EXPECT_NEAR(fit.alpha / fit.beta, 0.6, 0.05);
+}
+
+TEST(HawkesTest, ConcurrentModelPublishesConsistentState) {
+    const double mu = 2.0, alpha = 0.8, beta = 1.0;
+    std::vector<double> times;
+    HawkesSimulator(mu, alpha, beta).simulate(2000.0, 21, times);
+
+    // Single-threaded: identical to HawkesModel
+    HawkesModel reference(mu, alpha, beta);
+    ConcurrentHawkesModel shared(mu, alpha, beta);
+    std::vector<double> expected_intensity(times.size() + 1, mu);
+    std::vector<double> expected_time(times.size() + 1, 0.0);
+    for (size_t k = 0; k < times.size(); ++k) {
+        expected_intensity[k + 1] = reference.addEvent(times[k]);
+        expected_time[k + 1] = times[k];
+        EXPECT_DOUBLE_EQ(shared.addEvent(times[k]), expected_intensity[k + 1]);
+        EXPECT_DOUBLE_EQ(shared.getIntensity(times[k] + 0.5), reference.getIntensity(times[k] + 0.5));
+    }
+
+    // One writer, several readers: every snapshot must be a state the writer actually published
+    shared.reset();
+    EXPECT_EQ(shared.snapshot().n_events, 0u);
+
+    std::atomic<bool> done(false);
+    std::atomic<size_t> torn(0), reads(0);
+    std::atomic<int> started(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&]() {
+            size_t local_torn = 0, local_reads = 0;
+            started.fetch_add(1);
+            do {
+                ConcurrentHawkesModel::State s = shared.snapshot();
+                if (s.n_events >= expected_time.size() ||
+                    s.last_event_time != expected_time[s.n_events] ||
+                    s.last_intensity != expected_intensity[s.n_events]) {
+                    ++local_torn;
+                }
+                ++local_reads;
+            } while (!done.load(std::memory_order_acquire));
+            torn += local_torn;
+            reads += local_reads;
+        });
+    }
+    // Do not start writing before every reader runs (the writer can finish within one time slice)
+    while (started.load() < 3) std::this_thread::yield();
+    for (int pass = 0; pass < 20; ++pass) {
+        shared.reset();
+        for (double t : times) shared.addEvent(t);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : readers) t.join();
+
+    EXPECT_GT(reads.load(), 0u);
+    EXPECT_EQ(torn.load(), 0u);
+}
@@ -1,5 +1,13 @@
 #include <gtest/gtest.h>
 #include "../include/adaptive_exec/HMMRegimeDetector.hpp"
+#include "../include/adaptive_exec/HMMOnlineFilter.hpp"
+#include "../include/adaptive_exec/FixedHMMRegimeDetector.hpp"
+#include "../include/adaptive_exec/utils/SnapshotPublisher.hpp"
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <cmath>
+#include <thread>
 
 using namespace AdaptiveExec;
 
@@ -25,3 +33,541 @@ TEST(HMMTest, ViterbiDecoding) {
     EXPECT_EQ(states[2], 1);
     EXPECT_EQ(states[3], 1);
 }
+
+namespace {
+
+    // Sample a 2-state, 2-feature Gaussian HMM with a known parameter set
+    std::vector<Matrix> sampleTwoStateHMM(int n_sequences, int length, unsigned seed) {
+        std::mt19937 gen(seed);
+        std::normal_distribution<> z(0.0, 1.0);
+        std::uniform_real_distribution<> u(0.0, 1.0);
+        Matrix trans(2, 2); trans << 0.95, 0.05, 0.10, 0.90;
+
+        std::vector<Matrix> seqs;
+        for (int s = 0; s < n_sequences; ++s) {
+            Matrix obs(length, 2);
+            int state = (u(gen) < 0.5) ? 0 : 1;
+            for (int t = 0; t < length; ++t) {
+                if (t > 0) state = (u(gen) < trans(state, 0)) ? 0 : 1;
+                Scalar z1 = z(gen), z2 = z(gen);
+                if (state == 0) {
+                    obs(t, 0) = 1.0 + 0.3 * z1;
+                    obs(t, 1) = -1.0 + 0.5 * z2;
+                } else {
+                    // Correlated features in the high state
+                    obs(t, 0) = 3.0 + 0.6 * z1;
+                    obs(t, 1) = 2.0 + 0.6 * (0.8 * z1 + 0.6 * z2);
+                }
+            }
+            seqs.push_back(obs);
+        }
+        return seqs;
+    }
+
+}
+
+namespace {
+
+    // Reference filtered and smoothed posteriors by direct forward-backward
+    void referencePosteriors(const HMMRegimeDetector& hmm, const Matrix& obs, Matrix& filtered, Matrix& smoothed) {
+        const long T = obs.rows();
+        const int N = hmm.getNumStates();
+        const int D = hmm.getNumFeatures();
+        Matrix B(T, N);
+        for (long t = 0; t < T; ++t) {
+            for (int i = 0; i < N; ++i) {
+                Vector diff = obs.row(t).transpose() - hmm.getMeans().row(i).transpose();
+                Matrix cov = hmm.getVariances().block(i * D, 0, D, D);
+                B(t, i) = std::exp(-0.5 * diff.dot(cov.inverse() * diff)) / std::sqrt(std::pow(2 * M_PI, D) * cov.determinant());
+            }
+        }
+        const Matrix& A = hmm.getTransitionMatrix();
+        filtered.resize(T, N);
+        filtered.row(0) = hmm.getStartProb().transpose().cwiseProduct(B.row(0));
+        filtered.row(0) /= filtered.row(0).sum();
+        for (long t = 1; t < T; ++t) {
+            filtered.row(t) = (filtered.row(t - 1) * A).cwiseProduct(B.row(t));
+            filtered.row(t) /= filtered.row(t).sum();
+        }
+        Matrix beta = Matrix::Ones(T, N);
+        for (long t = T - 2; t >= 0; --t) {
+            beta.row(t) = (A * B.row(t + 1).cwiseProduct(beta.row(t + 1)).transpose()).transpose();
+            beta.row(t) /= beta.row(t).sum();
+        }
+        smoothed = filtered.cwiseProduct(beta);
+        for (long t = 0; t < T; ++t) smoothed.row(t) /= smoothed.row(t).sum();
+    }
+
+    // Dense reference Viterbi with log(A + 1e-9) scores; ties go to the lower index
+    std::vector<int> referenceViterbi(const HMMRegimeDetector& hmm, const Matrix& obs) {
+        const long T = obs.rows();
+        const int N = hmm.getNumStates();
+        const int D = hmm.getNumFeatures();
+        const Matrix& trans = hmm.getTransitionMatrix();
+        auto logEmit = [&](long t, int i) {
+            Vector diff = obs.row(t).transpose() - hmm.getMeans().row(i).transpose();
+            Matrix cov = hmm.getVariances().block(i * D, 0, D, D);
+            return -0.5 * (D * std::log(2 * M_PI) + std::log(cov.determinant()) + diff.dot(cov.inverse() * diff));
+        };
+
+        Matrix delta(T, N);
+        std::vector<std::vector<int>> psi(T, std::vector<int>(N, 0));
+        for (int i = 0; i < N; ++i) delta(0, i) = std::log(hmm.getStartProb()(i)) + logEmit(0, i);
+        for (long t = 1; t < T; ++t) {
+            for (int j = 0; j < N; ++j) {
+                Scalar best = -std::numeric_limits<Scalar>::infinity();
+                for (int i = 0; i < N; ++i) {
+                    Scalar p = delta(t - 1, i) + std::log(trans(i, j) + 1e-9);
+                    if (p > best) { best = p; psi[t][j] = i; }
+                }
+                delta(t, j) = best + logEmit(t, j);
+            }
+        }
+        std::vector<int> path(T);
+        delta.row(T - 1).maxCoeff(&path[T - 1]);
+        for (long t = T - 2; t >= 0; --t) path[t] = psi[t + 1][path[t + 1]];
+        return path;
+    }
+
+}
+
+TEST(HMMTest, OnlineFilterMatchesForwardBackward) {
+    std::vector<Matrix> seqs = sampleTwoStateHMM(1, 200, 31);
+    const Matrix& obs = seqs[0];
+
+    HMMRegimeDetector hmm(2);
+    Vector start(2); start << 0.6, 0.4;
+    Matrix trans(2, 2); trans << 0.95, 0.05, 0.10, 0.90;
+    Matrix means(2, 2); means << 1.0, -1.0, 3.0, 2.0;
+    Matrix vars(4, 2); vars << 0.09, 0.0, 0.0, 0.25, 0.36, 0.288, 0.288, 0.36;
+    hmm.setParameters(start, trans, means, vars);
+
+    Matrix filtered, smoothed;
+    referencePosteriors(hmm, obs, filtered, smoothed);
+
+    // Filtering only
+    HMMOnlineFilter filter(hmm);
+    for (long t = 0; t < obs.rows(); ++t) {
+        const Vector& post = filter.update(obs.row(t));
+        for (int i = 0; i < 2; ++i) EXPECT_NEAR(post(i), filtered(t, i), 1e-9);
+        int expected_state = filtered(t, 1) > filtered(t, 0) ? 1 : 0;
+        EXPECT_EQ(filter.currentState(), expected_state);
+    }
+
+    // Fixed-lag smoothing: at every bar t >= lag the smoothed posterior of bar t - lag
+    // equals the full smoother run on the prefix 0..t (covers the ring wrap-around)
+    const int lag = 5;
+    HMMOnlineFilter lagged(hmm, lag);
+    for (long t = 0; t < obs.rows(); ++t) {
+        lagged.update(obs.row(t));
+        EXPECT_EQ(lagged.hasSmoothed(), t >= lag);
+        if (!lagged.hasSmoothed()) continue;
+
+        Matrix prefix_filtered, prefix_smoothed;
+        referencePosteriors(hmm, obs.topRows(t + 1), prefix_filtered, prefix_smoothed);
+        for (int i = 0; i < 2; ++i) {
+            EXPECT_NEAR(lagged.smoothedPosterior()(i), prefix_smoothed(t - lag, i), 1e-9) << "bar " << t;
+        }
+    }
+    // The last window is the full smoother itself
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_NEAR(lagged.smoothedPosterior()(i), smoothed(obs.rows() - 1 - lag, i), 1e-9);
+    }
+}
+
+TEST(HMMTest, PredictProbaReturnsSmoothedPosteriors) {
+    std::vector<Matrix> seqs = sampleTwoStateHMM(1, 300, 47);
+    const Matrix& obs = seqs[0];
+
+    HMMRegimeDetector hmm(2);
+    Vector start(2); start << 0.6, 0.4;
+    Matrix trans(2, 2); trans << 0.95, 0.05, 0.10, 0.90;
+    Matrix means(2, 2); means << 1.0, -1.0, 3.0, 2.0;
+    Matrix vars(4, 2); vars << 0.09, 0.0, 0.0, 0.25, 0.36, 0.288, 0.288, 0.36;
+    hmm.setParameters(start, trans, means, vars);
+
+    Matrix filtered, smoothed;
+    referencePosteriors(hmm, obs, filtered, smoothed);
+
+    Matrix proba = hmm.predictProba(obs);
+    ASSERT_EQ(proba.rows(), obs.rows());
+    for (long t = 0; t < obs.rows(); ++t) {
+        for (int i = 0; i < 2; ++i) EXPECT_NEAR(proba(t, i), smoothed(t, i), 1e-9);
+    }
+
+    // Observations far in the tails underflow every linear-space emission;
+    // the log-space recursion must still return finite, normalised rows
+    Matrix extreme(5000, 2);
+    for (long t = 0; t < extreme.rows(); ++t) {
+        extreme(t, 0) = (t % 2 == 0) ? 80.0 : -60.0;
+        extreme(t, 1) = (t % 3 == 0) ? 90.0 : -75.0;
+    }
+    Matrix tail = hmm.predictProba(extreme);
+    for (long t = 0; t < tail.rows(); ++t) {
+        ASSERT_TRUE(tail.row(t).allFinite());
+        EXPECT_NEAR(tail.row(t).sum(), 1.0, 1e-9);
+    }
+}
+
+TEST(HMMTest, BaumWelchRecoversParameters) {
+    std::vector<Matrix> seqs = sampleTwoStateHMM(8, 500, 17);
+
+    HMMRegimeDetector hmm(2);
+    ThreadPool pool(4);
+    Scalar ll = hmm.fit(seqs, 200, 1e-6, pool);
+    EXPECT_TRUE(std::isfinite(ll));
+
+    // Quantile initialisation orders states by the first feature
+    const Matrix& means = hmm.getMeans();
+    EXPECT_NEAR(means(0, 0), 1.0, 0.05);
+    EXPECT_NEAR(means(0, 1), -1.0, 0.05);
+    EXPECT_NEAR(means(1, 0), 3.0, 0.1);
+    EXPECT_NEAR(means(1, 1), 2.0, 0.1);
+
+    const Matrix& trans = hmm.getTransitionMatrix();
+    EXPECT_NEAR(trans(0, 0), 0.95, 0.02);
+    EXPECT_NEAR(trans(1, 1), 0.90, 0.03);
+
+    // Full covariance: off-diagonal of the high state is 0.6 * 0.6 * 0.8
+    const Matrix& vars = hmm.getVariances();
+    EXPECT_NEAR(vars(2, 1), 0.288, 0.05);
+    EXPECT_NEAR(vars(0, 1), 0.0, 0.02);
+}
+
+TEST(HMMTest, BaumWelchIsDeterministicAcrossThreadCounts) {
+    std::vector<Matrix> seqs = sampleTwoStateHMM(6, 300, 23);
+
+    HMMRegimeDetector serial(2), parallel(2);
+    ThreadPool one(1), four(4);
+    Scalar ll_serial = serial.fit(seqs, 20, 1e-8, one);
+    Scalar ll_parallel = parallel.fit(seqs, 20, 1e-8, four);
+
+    EXPECT_EQ(ll_serial, ll_parallel);
+    EXPECT_EQ(serial.getMeans(), parallel.getMeans());
+    EXPECT_EQ(serial.getTransitionMatrix(), parallel.getTransitionMatrix());
+    EXPECT_EQ(serial.getVariances(), parallel.getVariances());
+}
+
+TEST(HMMTest, BaumWelchRejectsMismatchedFeatureCounts) {
+    std::vector<Matrix> seqs = sampleTwoStateHMM(3, 200, 29);
+    HMMRegimeDetector hmm(2);
+    hmm.fit(seqs, 5, 1e-8);
+    Matrix means = hmm.getMeans();
+    Matrix vars = hmm.getVariances();
+
+    // One sequence with an extra feature column (empty sequences are still skipped)
+    seqs.push_back(Matrix());
+    seqs.push_back(Matrix::Zero(50, 3));
+    EXPECT_EQ(hmm.fit(seqs, 5, 1e-8), 0.0);
+    EXPECT_EQ(hmm.getMeans(), means);
+    EXPECT_EQ(hmm.getVariances(), vars);
+    EXPECT_EQ(hmm.getNumFeatures(), 2);
+}
+
+TEST(HMMTest, FixedSizeDetectorMatchesDynamic) {
+    std::vector<Matrix> seqs = sampleTwoStateHMM(1, 1000, 41);
+    const Matrix& obs = seqs[0];
+
+    HMMRegimeDetector dynamic_hmm(3);
+    Vector start(3); start << 0.5, 0.3, 0.2;
+    Matrix trans(3, 3);
+    trans << 0.90, 0.08, 0.02,
+             0.05, 0.90, 0.05,
+             0.02, 0.08, 0.90;
+    Matrix means(3, 2); means << 1.0, -1.0, 2.0, 0.5, 3.0, 2.0;
+    Matrix vars(6, 2);
+    vars << 0.09, 0.0, 0.0, 0.25,
+            0.5, 0.1, 0.1, 0.5,
+            0.36, 0.288, 0.288, 0.36;
+    dynamic_hmm.setParameters(start, trans, means, vars);
+
+    FixedHMMRegimeDetector<3, 2> fixed_hmm;
+    ASSERT_TRUE(fixed_hmm.setParameters(dynamic_hmm));
+
+    // Dimension mismatch is rejected
+    FixedHMMRegimeDetector<2, 2> wrong_size;
+    EXPECT_FALSE(wrong_size.setParameters(dynamic_hmm));
+
+    for (int t = 0; t < 20; ++t) {
+        Eigen::Matrix<Scalar, 3, 1> fixed_emit;
+        fixed_hmm.logEmissions(obs.row(t).transpose(), fixed_emit);
+        for (int i = 0; i < 3; ++i) {
+            Vector diff = obs.row(t).transpose() - means.row(i).transpose();
+            Matrix cov = vars.block(i * 2, 0, 2, 2);
+            Scalar expected = -0.5 * (2 * std::log(2 * M_PI) + std::log(cov.determinant()) + diff.dot(cov.inverse() * diff));
+            EXPECT_NEAR(fixed_emit(i), expected, 1e-10);
+        }
+    }
+
+    EXPECT_EQ(fixed_hmm.predictStates(obs), dynamic_hmm.predictStates(obs));
+}
+
+TEST(HMMTest, CheckpointedViterbiMatchesFullDecode) {
+    std::vector<Matrix> seqs = sampleTwoStateHMM(1, 2000, 53);
+    const Matrix& obs = seqs[0];
+
+    HMMRegimeDetector hmm(3);
+    Vector start(3); start << 0.5, 0.3, 0.2;
+    Matrix trans(3, 3);
+    trans << 0.90, 0.08, 0.02,
+             0.05, 0.90, 0.05,
+             0.02, 0.08, 0.90;
+    Matrix means(3, 2); means << 1.0, -1.0, 2.0, 0.5, 3.0, 2.0;
+    Matrix vars(6, 2);
+    vars << 0.09, 0.0, 0.0, 0.25,
+            0.5, 0.1, 0.1, 0.5,
+            0.36, 0.288, 0.288, 0.36;
+    hmm.setParameters(start, trans, means, vars);
+
+    std::vector<int> full = hmm.predictStates(obs);
+    ASSERT_EQ(full.size(), static_cast<size_t>(obs.rows()));
+
+    // Default sqrt(T) interval, degenerate intervals and one that does not divide T
+    for (long k : {0L, 1L, 7L, 1999L, 2000L, 5000L}) {
+        EXPECT_EQ(hmm.predictStatesCheckpointed(obs, k), full) << "interval " << k;
+    }
+
+    // Single observation and prefixes of awkward lengths
+    for (long T : {1L, 2L, 3L, 45L, 46L}) {
+        Matrix prefix = obs.topRows(T);
+        EXPECT_EQ(hmm.predictStatesCheckpointed(prefix), hmm.predictStates(prefix)) << "T " << T;
+    }
+}
+
+TEST(HMMTest, BatchDecodeMatchesPerSequence) {
+    // Uneven lengths, including an empty sequence
+    std::vector<Matrix> seqs;
+    for (int s = 0; s < 12; ++s) {
+        int length = (s == 5) ? 0 : 50 + 97 * s;
+        std::vector<Matrix> one = sampleTwoStateHMM(1, std::max(length, 1), 100 + s);
+        seqs.push_back(one[0].topRows(length));
+    }
+
+    HMMRegimeDetector hmm(2);
+    Vector start(2); start << 0.6, 0.4;
+    Matrix trans(2, 2); trans << 0.95, 0.05, 0.10, 0.90;
+    Matrix means(2, 2); means << 1.0, -1.0, 3.0, 2.0;
+    Matrix vars(4, 2); vars << 0.09, 0.0, 0.0, 0.25, 0.36, 0.288, 0.288, 0.36;
+    hmm.setParameters(start, trans, means, vars);
+
+    ThreadPool pool(3);
+    std::vector<int> states;
+    Matrix proba;
+    hmm.predictStatesBatch(seqs, states, pool);
+    hmm.predictProbaBatch(seqs, proba, pool);
+
+    size_t offset = 0;
+    for (const Matrix& obs : seqs) {
+        std::vector<int> expected = hmm.predictStates(obs);
+        for (size_t t = 0; t < expected.size(); ++t) EXPECT_EQ(states[offset + t], expected[t]);
+
+        if (obs.rows() > 0) {
+            Matrix expected_proba = hmm.predictProba(obs);
+            EXPECT_LT((proba.middleRows(offset, obs.rows()) - expected_proba).cwiseAbs().maxCoeff(), 1e-12);
+        }
+        offset += obs.rows();
+    }
+    EXPECT_EQ(states.size(), offset);
+    EXPECT_EQ(proba.rows(), static_cast<long>(offset));
+}
+
+TEST(HMMTest, SnapshotPublisherHotSwapsParameters) {
+    // Version k: state means (k, k + 1) in every feature, so a torn update is detectable
+    auto makeModel = [](int k) {
+        std::unique_ptr<HMMRegimeDetector> hmm(new HMMRegimeDetector(2));
+        Vector start(2); start << 0.6, 0.4;
+        Matrix trans(2, 2); trans << 0.95, 0.05, 0.10, 0.90;
+        Matrix means(2, 2); means << k, k, k + 1, k + 1;
+        Matrix vars(4, 2); vars << 0.09, 0.0, 0.0, 0.25, 0.36, 0.288, 0.288, 0.36;
+        hmm->setParameters(start, trans, means, vars);
+        return hmm;
+    };
+
+    SnapshotPublisher<HMMRegimeDetector> models(makeModel(0), 4);
+    Matrix obs = sampleTwoStateHMM(1, 50, 61)[0];
+
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        int slot = models.registerReader();
+        ASSERT_GE(slot, 0);
+        readers.emplace_back([&, slot]() {
+            Scalar last_seen = 0.0;
+            while (!done.load()) {
+                auto model = models.read(slot);
+                const Matrix& m = model->getMeans();
+                if (m(0, 0) != m(0, 1) || m(1, 0) != m(0, 0) + 1 || m(1, 1) != m(0, 0) + 1) ++torn;
+                // Versions only move forward
+                if (m(0, 0) < last_seen) ++torn;
+                last_seen = m(0, 0);
+                if (model->predictStates(obs).size() != static_cast<size_t>(obs.rows())) ++torn;
+            }
+        });
+    }
+
+    for (int k = 1; k <= 200; ++k) models.publish(makeModel(k));
+    done = true;
+    for (auto& t : readers) t.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(models.epoch(), 201u);
+    EXPECT_EQ(models.read(0)->getMeans()(0, 0), 200.0);
+
+    // Slot 3 is the last one
+    EXPECT_EQ(models.registerReader(), 3);
+    EXPECT_EQ(models.registerReader(), -1);
+}
+
+TEST(HMMTest, SparseTransitionsMatchDenseRecursions) {
+    // 40 fine-grained states on a line, banded transitions (stay, or move one bucket)
+    const int N = 40;
+    Vector start = Vector::Constant(N, 1.0 / N);
+    Matrix trans = Matrix::Zero(N, N);
+    for (int i = 0; i < N; ++i) {
+        trans(i, i) = 0.8;
+        if (i > 0) trans(i, i - 1) = 0.1;
+        if (i + 1 < N) trans(i, i + 1) = 0.1;
+        trans.row(i) /= trans.row(i).sum();
+    }
+    Matrix means(N, 2);
+    Matrix vars = Matrix::Zero(2 * N, 2);
+    for (int i = 0; i < N; ++i) {
+        means(i, 0) = 0.5 * i;
+        means(i, 1) = std::sin(0.3 * i);
+        vars(2 * i, 0) = 0.3;
+        vars(2 * i + 1, 1) = 0.5;
+    }
+
+    HMMRegimeDetector hmm(N);
+    hmm.setParameters(start, trans, means, vars);
+    ASSERT_TRUE(hmm.usesSparseTransitions());
+
+    // Random walk over the buckets, with a few jumps that only the 1e-9 floor can explain
+    std::mt19937 gen(71);
+    std::normal_distribution<> z(0.0, 1.0);
+    std::uniform_real_distribution<> u(0.0, 1.0);
+    const long T = 400;
+    Matrix obs(T, 2);
+    int state = N / 2;
+    for (long t = 0; t < T; ++t) {
+        Scalar r = u(gen);
+        if (t % 100 == 99) state = (state + N / 2) % N;
+        else if (r < 0.1 && state > 0) --state;
+        else if (r > 0.9 && state + 1 < N) ++state;
+        obs(t, 0) = means(state, 0) + std::sqrt(0.3) * z(gen);
+        obs(t, 1) = means(state, 1) + std::sqrt(0.5) * z(gen);
+    }
+
+    std::vector<int> expected = referenceViterbi(hmm, obs);
+    EXPECT_EQ(hmm.predictStates(obs), expected);
+    EXPECT_EQ(hmm.predictStatesCheckpointed(obs), expected);
+
+    Matrix filtered, smoothed;
+    referencePosteriors(hmm, obs, filtered, smoothed);
+    Matrix proba = hmm.predictProba(obs);
+    EXPECT_LT((proba - smoothed).cwiseAbs().maxCoeff(), 1e-9);
+
+    // A dense matrix keeps the dense path
+    HMMRegimeDetector dense(2);
+    Matrix trans2(2, 2); trans2 << 0.95, 0.05, 0.10, 0.90;
+    dense.setParameters(Vector::Constant(2, 0.5), trans2, means.topRows(2), vars.topRows(4));
+    EXPECT_FALSE(dense.usesSparseTransitions());
+}
+
+TEST(HMMTest, SparseViterbiBreaksTiesLikeDensePath) {
+    // Three blocks of four identical states; each state stays or jumps to the same slot of the
+    // next block, so block members keep exactly equal Viterbi scores at every step. Block 2
+    // starts with zero probability, so its scores begin at -inf.
+    const int N = 12;
+    Vector start = Vector::Zero(N);
+    start.head(8).setConstant(1.0 / 8);
+    Matrix trans = Matrix::Zero(N, N);
+    Matrix means(N, 1);
+    Matrix vars = Matrix::Ones(N, 1);
+    for (int i = 0; i < N; ++i) {
+        trans(i, i) = 0.8;
+        trans(i, (i + 4) % N) = 0.2;
+        means(i, 0) = 2.0 * (i / 4);
+    }
+
+    HMMRegimeDetector hmm(N);
+    hmm.setParameters(start, trans, means, vars);
+    ASSERT_TRUE(hmm.usesSparseTransitions());
+
+    std::mt19937 gen(5);
+    std::normal_distribution<> z(0.0, 1.0);
+    Matrix obs(120, 1);
+    for (long t = 0; t < obs.rows(); ++t) obs(t, 0) = 2.0 * ((t / 20) % 3) + 0.5 * z(gen);
+
+    std::vector<int> expected = referenceViterbi(hmm, obs);
+    EXPECT_EQ(hmm.predictStates(obs), expected);
+    EXPECT_EQ(hmm.predictStatesCheckpointed(obs, 7), expected);
+}
+
+TEST(HMMTest, SingularCovarianceKeepsEmissionPathsConsistent) {
+    // State 0 lives on the line x = y (rank-1 covariance), state 1 is isotropic
+    HMMRegimeDetector hmm(2);
+    Vector start = Vector::Constant(2, 0.5);
+    Matrix trans = Matrix::Constant(2, 2, 0.5);
+    Matrix means(2, 2); means << 0.0, 0.0, 0.5, -0.5;
+    Matrix vars(4, 2);
+    vars << 1.0, 1.0,
+            1.0, 1.0,
+            1.0, 0.0,
+            0.0, 1.0;
+    hmm.setParameters(start, trans, means, vars);
+
+    // With uniform transitions every bar decodes independently, so the Viterbi path is the
+    // per-bar argmax of the posterior and both must see the same emission densities
+    std::mt19937 gen(17);
+    std::normal_distribution<> z(0.0, 1.0);
+    Matrix obs(200, 2);
+    for (long t = 0; t < obs.rows(); ++t) {
+        Scalar a = z(gen);
+        if (t % 2 == 0) obs.row(t) << a, a;
+        else obs.row(t) << 0.5 + z(gen), -0.5 + z(gen);
+    }
+
+    Matrix proba = hmm.predictProba(obs);
+    ASSERT_TRUE(proba.allFinite());
+    std::vector<int> states = hmm.predictStates(obs);
+    ASSERT_EQ(states.size(), static_cast<size_t>(obs.rows()));
+    for (long t = 0; t < obs.rows(); ++t) {
+        int best;
+        proba.row(t).maxCoeff(&best);
+        EXPECT_EQ(states[t], best) << "bar " << t;
+        EXPECT_NEAR(proba.row(t).sum(), 1.0, 1e-9);
+    }
+    // Points on the degenerate line belong to the singular state
+    EXPECT_EQ(states[0], 0);
+    EXPECT_EQ(states[1], 1);
+}
+
+TEST(HMMTest, ViterbiDecodesMoreThan256States) {
+    // 300 well-separated 1-D states: back-pointers no longer fit in a byte
+    const int N = 300;
+    HMMRegimeDetector hmm(N);
+    Vector start = Vector::Constant(N, 1.0 / N);
+    Matrix trans = Matrix::Constant(N, N, 0.1 / (N - 1));
+    trans.diagonal().setConstant(0.9);
+    Matrix means(N, 1), vars(N, 1);
+    for (int i = 0; i < N; ++i) {
+        means(i, 0) = 10.0 * i;
+        vars(i, 0) = 1.0;
+    }
+    hmm.setParameters(start, trans, means, vars);
+
+    std::vector<int> expected = {299, 299, 270, 270, 3, 3, 3, 256, 257, 0, 150, 299};
+    Matrix obs(expected.size(), 1);
+    for (size_t t = 0; t < expected.size(); ++t) obs(t, 0) = 10.0 * expected[t] + 0.1;
+
+    EXPECT_EQ(hmm.predictStates(obs), expected);
+    EXPECT_EQ(hmm.predictStatesCheckpointed(obs, 5), expected);
+
+    std::vector<int> batch;
+    hmm.predictStatesBatch({obs, obs}, batch);
+    ASSERT_EQ(batch.size(), 2 * expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), batch.begin()));
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), batch.begin() + expected.size()));
+}
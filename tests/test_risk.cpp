@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "../include/adaptive_exec/RiskManager.hpp"
+#include "../include/adaptive_exec/ExecutionEngine.hpp"
+#include "../include/adaptive_exec/backtest/BacktestEngine.hpp"
+#include "../include/adaptive_exec/utils/KillSwitch.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <algorithm>
+
+using namespace AdaptiveExec;
+
+TEST(RiskManagerTest, CVaRViewMatchesSortedTail) {
+    std::vector<Scalar> returns;
+    for (int i = 0; i < 200; ++i) returns.push_back(0.001 * ((i * 73) % 101 - 50));
+
+    // Reference: mean of the worst ceil(alpha * N) returns
+    std::vector<Scalar> sorted = returns;
+    std::sort(sorted.begin(), sorted.end());
+    Scalar expected = 0.0;
+    for (int i = 0; i < 10; ++i) expected -= sorted[i];
+    expected /= 10.0;
+
+    EXPECT_NEAR(RiskManager::computeCVaR(returns, 0.05), expected, 1e-15);
+    // Tail of a sub-window, passed as a pointer + length view
+    std::vector<Scalar> window(returns.begin() + 100, returns.end());
+    EXPECT_NEAR(RiskManager::computeCVaR(returns.data() + 100, 100, 0.05),
+                RiskManager::computeCVaR(window, 0.05), 1e-15);
+}
+
+TEST(RiskManagerTest, KillSwitchHaltsOrderPathAcrossThreadsAndMappings) {
+    KillSwitch& halt = KillSwitch::global();
+    halt.reset();
+
+    // Breach without the flag only reports; with it, every order path halts
+    EXPECT_TRUE(ExecutionEngine::checkCircuitBreaker(6.0, 5.0));
+    EXPECT_FALSE(ExecutionEngine::isHalted());
+    EXPECT_FALSE(ExecutionEngine::checkCircuitBreaker(4.0, 5.0, true));
+    EXPECT_FALSE(ExecutionEngine::isHalted());
+    EXPECT_TRUE(ExecutionEngine::checkCircuitBreaker(6.0, 5.0, true));
+    EXPECT_TRUE(ExecutionEngine::isHalted());
+    EXPECT_TRUE(halt.hasReason(TripReason::HawkesIntensity));
+    EXPECT_GT(halt.tripTimeNs(), 0);
+
+    BacktestEngine backtest(100000.0);
+    backtest.executeOrder(0, 100.0, 10.0, MarketRegime::Normal);
+    EXPECT_TRUE(backtest.getTrades().empty());
+
+    // Only the first tripper wins; later reasons are still recorded
+    EXPECT_FALSE(halt.trip(TripReason::CVaRBreach));
+    EXPECT_TRUE(halt.hasReason(TripReason::CVaRBreach));
+    halt.reset();
+    backtest.executeOrder(0, 100.0, 10.0, MarketRegime::Normal);
+    EXPECT_EQ(backtest.getTrades().size(), 1u);
+
+    // A trip on one thread is observed by a spinning order thread
+    std::atomic<bool> seen(false);
+    std::thread order_thread([&]() {
+        while (!halt.isTripped()) std::this_thread::yield();
+        seen = true;
+    });
+    EXPECT_TRUE(halt.trip(TripReason::JumpDetected));
+    order_thread.join();
+    EXPECT_TRUE(seen.load());
+    halt.reset();
+
+    // Two mappings of one segment stand in for sibling processes
+    const std::string name = "/adaptive_exec_test_" + std::to_string(getpid());
+    KillSwitch a, b;
+    ASSERT_TRUE(a.attachShared(name));
+    ASSERT_TRUE(b.attachShared(name));
+    EXPECT_FALSE(b.isTripped());
+    EXPECT_TRUE(a.trip(TripReason::Manual));
+    EXPECT_TRUE(b.isTripped());
+    EXPECT_FALSE(b.trip(TripReason::CVaRBreach));
+    b.reset();
+    EXPECT_FALSE(a.isTripped());
+
+    // Detaching while halted keeps the process halted
+    a.trip();
+    b.detachShared();
+    EXPECT_TRUE(b.isTripped());
+    a.reset();
+    EXPECT_TRUE(b.isTripped());
+    a.detachShared();
+    EXPECT_TRUE(KillSwitch::unlinkShared(name));
+}
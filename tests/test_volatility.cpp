@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
 #include "../include/adaptive_exec/VolatilityEstimators.hpp"
+#include "../include/adaptive_exec/StreamingVolatility.hpp"
+#include "../include/adaptive_exec/CrossSectionalVolatility.hpp"
 #include <vector>
 #include <cmath>
+#include <random>
 
 using namespace AdaptiveExec;
 
@@ -45,3 +48,205 @@ TEST(VolatilityEstimatorsTest, BipowerVariationRobustness) {
     // BV should be less than RV in presence of jump
     EXPECT_LT(bv, rv);
 }
+
+TEST(StreamingVolatilityTest, MatchesBatchEstimatorsAtEveryTick) {
+    std::mt19937 gen(7);
+    std::normal_distribution<> noise(0.0, 0.001);
+    std::vector<Scalar> returns(200);
+    for (auto& r : returns) r = noise(gen);
+    returns[120] = 0.02; // Jump
+
+    StreamingVolatility stream(5, 252.0);
+    std::vector<Scalar> prefix;
+    for (Scalar r : returns) {
+        stream.update(r);
+        prefix.push_back(r);
+
+        EXPECT_DOUBLE_EQ(stream.rv(), VolatilityEstimators::computeRV(prefix, 252.0));
+        EXPECT_DOUBLE_EQ(stream.bv(), VolatilityEstimators::computeBV(prefix, 252.0));
+        EXPECT_DOUBLE_EQ(stream.medRV(), VolatilityEstimators::computeMedRV(prefix, 252.0));
+        EXPECT_DOUBLE_EQ(stream.rj(), VolatilityEstimators::computeRJ(prefix, 252.0));
+        EXPECT_DOUBLE_EQ(stream.tsrv(), VolatilityEstimators::computeTSRV(prefix, 5, 252.0));
+    }
+
+    stream.reset();
+    EXPECT_EQ(stream.count(), 0u);
+    EXPECT_EQ(stream.rv(), 0.0);
+}
+
+TEST(VolatilityEstimatorsTest, LeeMyklandRollingMatchesNaiveWindow) {
+    std::mt19937 gen(11);
+    std::normal_distribution<> noise(0.0, 0.01);
+    std::vector<Scalar> returns(2000);
+    for (auto& r : returns) r = noise(gen);
+    returns[700] = 0.15;
+
+    const size_t window = 270;
+    auto stats = VolatilityEstimators::computeLeeMykland(returns, window);
+
+    StreamingLeeMykland live(window);
+    for (size_t i = 0; i < returns.size(); ++i) {
+        Scalar live_stat = live.update(returns[i]);
+        if (i < window) {
+            EXPECT_EQ(stats[i], 0.0);
+            EXPECT_EQ(live_stat, 0.0);
+            continue;
+        }
+
+        // Reference: direct O(K) local bipower sum
+        Scalar sum = 0.0;
+        for (size_t j = i - window; j < i - 1; ++j) sum += std::abs(returns[j]) * std::abs(returns[j+1]);
+        Scalar expected = std::abs(returns[i]) / std::sqrt((M_PI / 2.0) * sum / (window - 1));
+
+        EXPECT_NEAR(stats[i], expected, 1e-10 * expected);
+        EXPECT_NEAR(live_stat, expected, 1e-10 * expected);
+    }
+    EXPECT_GT(stats[700], 5.0);
+}
+
+TEST(VolatilityEstimatorsTest, FusedFeaturesMatchPerFunctionPath) {
+    std::mt19937 gen(3);
+    std::normal_distribution<> noise(0.0, 0.001);
+
+    // Cover empty/short inputs, SIMD remainders and several kernel blocks
+    for (size_t n : {0, 1, 2, 3, 4, 7, 9, 17, 4099, 23400}) {
+        std::vector<Scalar> returns(n);
+        for (auto& r : returns) r = noise(gen);
+        if (n > 10) returns[n / 2] = 0.03;
+
+        VolatilityFeatures f = VolatilityEstimators::computeFeatures(returns, 5, 252.0);
+        Scalar tol = 1e-12;
+        EXPECT_NEAR(f.rv, VolatilityEstimators::computeRV(returns, 252.0), tol);
+        EXPECT_NEAR(f.bv, VolatilityEstimators::computeBV(returns, 252.0), tol);
+        EXPECT_NEAR(f.medrv, VolatilityEstimators::computeMedRV(returns, 252.0), tol);
+        EXPECT_NEAR(f.rj, VolatilityEstimators::computeRJ(returns, 252.0), tol);
+        EXPECT_NEAR(f.tsrv, VolatilityEstimators::computeTSRV(returns, 5, 252.0), tol);
+    }
+}
+
+TEST(CrossSectionalVolatilityTest, MatchesPerSymbolEstimators) {
+    std::mt19937 gen(5);
+    std::normal_distribution<> noise(0.0, 0.001);
+
+    // Very uneven symbol lengths (including empty and one-tick symbols)
+    std::vector<size_t> lengths = {0, 1, 3, 50000, 12, 390, 7, 23400, 2, 100};
+    for (int i = 0; i < 200; ++i) lengths.push_back(10 + (i * 37) % 2000);
+
+    std::vector<Scalar> buffer;
+    std::vector<size_t> offsets = {0};
+    for (size_t len : lengths) {
+        for (size_t i = 0; i < len; ++i) buffer.push_back(noise(gen));
+        offsets.push_back(buffer.size());
+    }
+
+    ReturnPanel panel = {buffer.data(), offsets.data(), lengths.size()};
+    VolatilityTable table;
+    ThreadPool pool(4);
+    CrossSectionalVolatility::compute(panel, table, 5, 252.0, pool);
+
+    ASSERT_EQ(table.size(), lengths.size());
+    for (size_t s = 0; s < lengths.size(); ++s) {
+        std::vector<Scalar> r(buffer.begin() + offsets[s], buffer.begin() + offsets[s + 1]);
+        Scalar tol = 1e-12;
+        EXPECT_NEAR(table.rv[s], VolatilityEstimators::computeRV(r, 252.0), tol);
+        EXPECT_NEAR(table.bv[s], VolatilityEstimators::computeBV(r, 252.0), tol);
+        EXPECT_NEAR(table.medrv[s], VolatilityEstimators::computeMedRV(r, 252.0), tol);
+        EXPECT_NEAR(table.tsrv[s], VolatilityEstimators::computeTSRV(r, 5, 252.0), tol);
+        EXPECT_NEAR(table.rj[s], VolatilityEstimators::computeRJ(r, 252.0), tol);
+    }
+}
+
+TEST(VolatilityEstimatorsTest, ViewOverloadsMatchVectorOverloads) {
+    std::mt19937 gen(9);
+    std::normal_distribution<> noise(0.0, 0.001);
+    std::vector<Scalar> buffer(1000);
+    for (auto& r : buffer) r = noise(gen);
+
+    // Slice [200, 700) of a larger buffer, passed without copying
+    const Scalar* slice = buffer.data() + 200;
+    size_t n = 500;
+    std::vector<Scalar> copy(slice, slice + n);
+
+    EXPECT_EQ(VolatilityEstimators::computeRV(slice, n), VolatilityEstimators::computeRV(copy));
+    EXPECT_EQ(VolatilityEstimators::computeBV(slice, n), VolatilityEstimators::computeBV(copy));
+    EXPECT_EQ(VolatilityEstimators::computeMedRV(slice, n), VolatilityEstimators::computeMedRV(copy));
+    EXPECT_EQ(VolatilityEstimators::computeRJ(slice, n), VolatilityEstimators::computeRJ(copy));
+    EXPECT_EQ(VolatilityEstimators::computeTSRV(slice, n, 5), VolatilityEstimators::computeTSRV(copy, 5));
+
+    std::vector<Scalar> stats(n);
+    VolatilityEstimators::computeLeeMykland(slice, n, stats.data(), 16);
+    EXPECT_EQ(stats, VolatilityEstimators::computeLeeMykland(copy, 16));
+}
+
+TEST(VolatilityEstimatorsTest, NoiseRobustMatchesExplicitGrids) {
+    std::mt19937 gen(21);
+    std::normal_distribution<> noise(0.0, 0.001);
+    std::vector<Scalar> returns(997);
+    for (auto& r : returns) r = noise(gen);
+    const int K = 7, M = 6, H = 5;
+    const size_t n = returns.size();
+
+    // Averaged RV at scale k, built grid by grid from the sparse price path
+    std::vector<Scalar> price(n + 1, 0.0);
+    for (size_t i = 0; i < n; ++i) price[i + 1] = price[i] + returns[i];
+    auto gridRV = [&](int k) {
+        Scalar total = 0.0;
+        for (int g = 0; g < k; ++g) {
+            for (size_t j = g + k; j <= n; j += k) total += std::pow(price[j] - price[j - k], 2);
+        }
+        return total / k;
+    };
+
+    Scalar n_bar = static_cast<Scalar>(n - K + 1) / K;
+    Scalar tsrv = (gridRV(K) - (n_bar / n) * gridRV(1)) / (1.0 - n_bar / n);
+
+    Scalar msrv = 0.0;
+    for (int i = 1; i <= M; ++i) {
+        Scalar a = 12.0 * i / (M * M) * (static_cast<Scalar>(i) / M - 0.5 - 0.5 / M) / (1.0 - 1.0 / (M * M));
+        msrv += a * gridRV(i);
+    }
+
+    Scalar rk = 0.0;
+    for (int h = -H; h <= H; ++h) {
+        Scalar x = std::abs(h) / static_cast<Scalar>(H + 1);
+        Scalar w = (x <= 0.5) ? 1 - 6 * x * x + 6 * x * x * x : 2 * std::pow(1 - x, 3);
+        for (size_t j = std::abs(h); j < n; ++j) rk += w * returns[j] * returns[j - std::abs(h)];
+    }
+
+    NoiseRobustFeatures f = VolatilityEstimators::computeNoiseRobust(returns, K, M, H);
+    EXPECT_NEAR(f.tsrv, std::max(0.0, tsrv), 1e-12);
+    EXPECT_NEAR(f.msrv, std::max(0.0, msrv), 1e-12);
+    EXPECT_NEAR(f.realized_kernel, std::max(0.0, rk), 1e-12);
+
+    // K inside the MSRV scales (no separate scale-K accumulator)
+    const int K_small = 4;
+    Scalar n_bar_small = static_cast<Scalar>(n - K_small + 1) / K_small;
+    Scalar tsrv_small = (gridRV(K_small) - (n_bar_small / n) * gridRV(1)) / (1.0 - n_bar_small / n);
+    NoiseRobustFeatures g = VolatilityEstimators::computeNoiseRobust(returns, K_small, M, H);
+    EXPECT_NEAR(g.tsrv, std::max(0.0, tsrv_small), 1e-12);
+    EXPECT_NEAR(g.msrv, f.msrv, 1e-15);
+}
+
+TEST(VolatilityEstimatorsTest, NoiseRobustRemovesMicrostructureBias) {
+    // Efficient price with daily IV = 1e-4 observed through iid bid-ask noise
+    std::mt19937 gen(4);
+    const size_t n = 23400;
+    std::normal_distribution<> diffusion(0.0, std::sqrt(1e-4 / n));
+    std::normal_distribution<> bid_ask(0.0, 0.0005);
+
+    std::vector<Scalar> returns(n);
+    Scalar prev_noise = bid_ask(gen);
+    for (auto& r : returns) {
+        Scalar u = bid_ask(gen);
+        r = diffusion(gen) + u - prev_noise;
+        prev_noise = u;
+    }
+
+    // Plain RV is dominated by 2 * n * omega^2 ~ 1.2e-2
+    EXPECT_GT(VolatilityEstimators::computeRV(returns), 50 * 1e-4);
+
+    NoiseRobustFeatures f = VolatilityEstimators::computeNoiseRobust(returns, 600, 600, 130);
+    EXPECT_NEAR(f.tsrv, 1e-4, 0.4e-4);
+    EXPECT_NEAR(f.msrv, 1e-4, 0.4e-4);
+    EXPECT_NEAR(f.realized_kernel, 1e-4, 0.4e-4);
+}